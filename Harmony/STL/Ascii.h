@@ -11,9 +11,11 @@
 // #include <array>
 // #include <charconv>
 // #include <cmath>
+#include <cstddef>
 #include <expected>
 
 #include <iosfwd>
+#include <memory_resource>
 // #include <optional>
 #include <string>
 #include <string_view>
@@ -21,6 +23,9 @@
 // #include <vector>
 
 #include "Mesh.h"
+#include "MeshSoA.h"
+#include "Options.h"
+#include "ParseConfig.h"
 
 namespace Harmony::STL::ASCII {
 
@@ -28,14 +33,46 @@ namespace Harmony::STL::ASCII {
 [[nodiscard]] std::expected<Mesh, std::string>
 parse(std::string_view text, bool compute_missing_normals = true) noexcept;
 
-/// Parse from a stream (reads the whole stream text)
+/// Parse with options. With `threads` > 1 a large buffer is split at
+/// 'facet' lines and the chunks are parsed concurrently; the result,
+/// including any error message and its line number, matches a serial parse.
+[[nodiscard]] std::expected<Mesh, std::string>
+parse(std::string_view text, const ParseOptions& options);
+
+/// Parse into `mesh`, reusing the capacity it already has (name and
+/// triangles are replaced; on error it is left without triangles)
+[[nodiscard]] std::expected<void, std::string>
+parse_into(std::string_view text, Mesh& mesh, const ParseOptions& options = {});
+
+/// Parse into a mesh whose storage comes from `resource` (e.g. a
+/// std::pmr::monotonic_buffer_resource shared by many small parts)
+[[nodiscard]] std::expected<pmr::Mesh, std::string>
+parse(std::string_view text, std::pmr::memory_resource* resource,
+      bool compute_missing_normals = true) noexcept;
+
+/// Parse an ASCII STL buffer straight into structure-of-arrays form
+[[nodiscard]] std::expected<MeshSoA, std::string>
+parse_soa(std::string_view text, bool compute_missing_normals = true) noexcept;
+
+/// Serial parse specialised for `Config` at compile time, e.g.
+/// parse<ParseConfig{.normals = NormalPolicy::recompute, .validate = false}>(text)
+template <ParseConfig Config>
+[[nodiscard]] std::expected<ParsedMesh<Config>, std::string> parse(std::string_view text);
+
+/// Parse from a stream, reading it a block at a time
 [[nodiscard]] std::expected<Mesh, std::string>
 parse(std::istream& is, bool compute_missing_normals = true);
 
+/// Number of whole-word 'endfacet' keywords (any case) in `text`: the facet
+/// count of a well-formed file, found with a vectorised scan and no parse
+[[nodiscard]] std::size_t count_facets(std::string_view text) noexcept;
+
 /// Serialize to ASCII STL string
 [[nodiscard]] std::string serialize(const Mesh& mesh, int float_precision = 6);
+[[nodiscard]] std::string serialize(const Mesh& mesh, const SerializeOptions& options);
 
-/// Serialize to stream (returns false on I/O error)
+/// Serialize to stream in ~1 MiB chunks (returns false on I/O error)
 bool serialize(std::ostream& os, const Mesh& mesh, int float_precision = 6);
+bool serialize(std::ostream& os, const Mesh& mesh, const SerializeOptions& options);
 
 } // namespace Harmony::STL::ASCII
@@ -0,0 +1,68 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "Mesh.h"
+#include "Options.h"
+
+namespace Harmony::STL {
+
+using LoadResult = std::expected<Mesh, std::string>;
+
+/// Batch loader that keeps the disk and the CPU busy at the same time:
+/// I/O threads read whole files ahead into memory while a pool of workers
+/// parses the files already read, so reading one file overlaps parsing
+/// another. Requests are started in submission order.
+///
+/// The destructor finishes every request already submitted.
+class AsyncLoader {
+public:
+    struct Config {
+        /// Threads issuing reads; more than one helps on SSDs and network storage
+        unsigned io_threads = 1;
+        /// Parsing threads: 0 = hardware concurrency
+        unsigned parse_threads = 0;
+        /// Read-ahead stops while this many bytes wait to be parsed
+        /// (a single larger file is still read)
+        std::size_t max_buffered_bytes = std::size_t{256} << 20;
+        /// Applied to every file; `geometry` is ignored, as the files are
+        /// parsed concurrently
+        ParseOptions options;
+    };
+
+    AsyncLoader();
+    explicit AsyncLoader(const Config& config);
+    AsyncLoader(const AsyncLoader&) = delete;
+    AsyncLoader& operator=(const AsyncLoader&) = delete;
+    ~AsyncLoader();
+
+    /// Queue `path`; the future holds the mesh or a "STL: ..." / parse() error
+    [[nodiscard]] std::future<LoadResult> load_async(const std::filesystem::path& path);
+
+    /// Bytes read but not yet parsed
+    [[nodiscard]] std::size_t buffered_bytes() const noexcept;
+
+private:
+    struct State;
+    std::unique_ptr<State> state_;
+};
+
+/// One-off asynchronous load() on its own thread. For many files prefer an
+/// AsyncLoader, which overlaps the reads with the parsing.
+[[nodiscard]] std::future<LoadResult>
+load_async(const std::filesystem::path& path, const ParseOptions& options = {});
+
+} // namespace Harmony::STL
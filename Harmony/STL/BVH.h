@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "IndexedMesh.h"
+#include "Mesh.h"
+#include "MeshSoA.h"
+
+namespace Harmony::STL {
+
+/// Axis-aligned box; empty (min > max) by default
+struct Box {
+    Vec3 min{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+             std::numeric_limits<float>::infinity()};
+    Vec3 max{-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+             -std::numeric_limits<float>::infinity()};
+};
+
+struct Ray {
+    Vec3 origin{};
+    Vec3 direction{}; ///< need not be normalised; t is measured in its length
+    float tmin = 0.0f;
+    float tmax = std::numeric_limits<float>::infinity();
+};
+
+struct RayHit {
+    std::uint32_t face = 0; ///< index of the face in the mesh the BVH was built from
+    float t = 0.0f;         ///< origin + t * direction
+    float u = 0.0f, v = 0.0f; ///< barycentrics: (1-u-v) v0 + u v1 + v v2
+};
+
+struct ClosestPoint {
+    std::uint32_t face = 0;
+    Vec3 point{};
+    float distance = 0.0f;
+};
+
+struct BVHBuildOptions {
+    /// 1 = serial, 0 = hardware concurrency
+    unsigned threads = 1;
+    /// Leaves above this size are always split
+    std::size_t max_leaf_size = 4;
+    /// SAH candidate planes per axis are bins - 1 (2..64)
+    unsigned bins = 16;
+};
+
+/// Bounding volume hierarchy over the faces of a mesh. Built top-down with
+/// binned SAH (subtrees in parallel), then flattened into 4-wide nodes
+/// whose child boxes are tested together. The BVH keeps its own copy of
+/// the triangles in leaf order, so queries never touch the mesh; it is
+/// immutable once built and safe to query from many threads.
+class BVH {
+public:
+    using BuildOptions = BVHBuildOptions;
+
+    static constexpr std::size_t width = 4;
+    static constexpr std::uint32_t leaf_bit = 0x80000000u;
+    static constexpr std::uint32_t empty_slot = 0xFFFFFFFFu;
+
+    /// Four child boxes in SoA form, 128 bytes. A slot refers to an inner
+    /// node (child > the node's own index), a leaf (leaf_bit | first
+    /// triangle, with count triangles) or nothing (empty_slot).
+    struct Node {
+        float min_x[width], min_y[width], min_z[width];
+        float max_x[width], max_y[width], max_z[width];
+        std::uint32_t child[width];
+        std::uint32_t count[width];
+    };
+
+    /// Leaf triangle with the edges Möller-Trumbore needs precomputed
+    struct Tri {
+        Vec3 v0, e1, e2;
+        std::uint32_t face;
+    };
+
+    BVH() = default;
+
+    /// Throws std::length_error past 2^31 - 1 faces
+    [[nodiscard]] static BVH build(std::span<const Triangle> tris, const BuildOptions& options = {});
+    [[nodiscard]] static BVH build(const MeshSoA& mesh, const BuildOptions& options = {});
+    [[nodiscard]] static BVH build(const IndexedMesh& mesh, const BuildOptions& options = {});
+
+    /// Closest hit with ray.tmin < t < ray.tmax; both sides of a face count
+    [[nodiscard]] std::optional<RayHit> intersect(const Ray& ray) const noexcept;
+
+    /// True if anything is hit with ray.tmin < t < ray.tmax (stops at the first)
+    [[nodiscard]] bool occluded(const Ray& ray) const noexcept;
+
+    /// Append the faces whose bounds overlap `box`
+    void query(const Box& box, std::vector<std::uint32_t>& faces) const;
+
+    /// Nearest point on the surface within `max_distance` of `p`
+    [[nodiscard]] std::optional<ClosestPoint>
+    closest_point(const Vec3& p, float max_distance = std::numeric_limits<float>::infinity()) const noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept { return tris_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return tris_.empty(); }
+    [[nodiscard]] const Box& bounds() const noexcept { return bounds_; }
+    [[nodiscard]] std::span<const Node> nodes() const noexcept { return nodes_; }
+    [[nodiscard]] std::span<const Tri> triangles() const noexcept { return tris_; }
+
+    /// Portable little-endian image of the hierarchy
+    [[nodiscard]] std::vector<std::byte> encode() const;
+
+    /// Validates every index, so damaged input cannot send queries astray
+    [[nodiscard]] static std::expected<BVH, std::string> decode(std::span<const std::byte> bytes);
+
+private:
+    struct Builder;
+
+    std::vector<Node> nodes_; // nodes_[0] is the root
+    std::vector<Tri> tris_;
+    Box bounds_;
+};
+
+} // namespace Harmony::STL
@@ -20,23 +20,142 @@
 #include <algorithm>
 #include <type_traits>
 #include <cstring> // std::memcpy
+#include <filesystem>
+#include <memory_resource>
+#include <optional>
+#include <cstddef>
+#include <compare>
+#include <iterator>
+#include <ranges>
+#include <vector>
 
 #include "Mesh.h"
+#include "MeshSoA.h"
+#include "Options.h"
+#include "ParseConfig.h"
 
 namespace Harmony::STL::Binary {
 
-/// Parse a binary STL from a contiguous text buffer
+/// Fixed layout: 80-byte header, uint32 LE triangle count, 50-byte records
+inline constexpr std::size_t header_size = 80;
+inline constexpr std::size_t prefix_size = header_size + 4;
+inline constexpr std::size_t record_size = 50;
+
+/// Parse a binary STL from a contiguous byte buffer (e.g. a memory mapping)
 [[nodiscard]] std::expected<Mesh, std::string>
 parse(std::string_view text, bool compute_missing_normals = true) noexcept;
 
+/// Buffer parse; large inputs are decoded on `options.threads` threads,
+/// each filling a disjoint slice of Mesh::tris (order is unchanged)
+[[nodiscard]] std::expected<Mesh, std::string>
+parse(std::string_view text, const ParseOptions& options);
+
+/// Parse into `mesh`, reusing the capacity it already has (name and
+/// triangles are replaced; on error it is left without triangles)
+[[nodiscard]] std::expected<void, std::string>
+parse_into(std::string_view text, Mesh& mesh, const ParseOptions& options = {});
+
+/// Parse into a mesh whose storage comes from `resource`
+[[nodiscard]] std::expected<pmr::Mesh, std::string>
+parse(std::string_view text, std::pmr::memory_resource* resource,
+      bool compute_missing_normals = true) noexcept;
+
 /// Parse from a stream (reads the whole stream text)
 [[nodiscard]] std::expected<Mesh, std::string>
 parse(std::istream& is, bool compute_missing_normals = true);
 
+/// Parse a binary STL buffer straight into structure-of-arrays form
+[[nodiscard]] std::expected<MeshSoA, std::string>
+parse_soa(std::string_view text, bool compute_missing_normals = true) noexcept;
+
+/// Serial parse specialised for `Config` at compile time: records are
+/// decoded a cache-sized block at a time and each block's normals are
+/// handled while it is still in cache. `validate` has no effect here.
+template <ParseConfig Config>
+[[nodiscard]] std::expected<ParsedMesh<Config>, std::string> parse(std::string_view text);
+
+/// Memory-map `path` and decode the records straight from the mapping
+[[nodiscard]] std::expected<Mesh, std::string>
+load(const std::filesystem::path& path, bool compute_missing_normals = true);
+
+[[nodiscard]] std::expected<Mesh, std::string>
+load(const std::filesystem::path& path, const ParseOptions& options);
+
+/// Decode only records [first, first + count) of a binary STL buffer into
+/// a mesh of those triangles. The range is clipped to the header's count,
+/// and the buffer is validated as by parse(). Only the header and the
+/// range's own bytes are read, so on a mapping just that slice pages in.
+[[nodiscard]] std::expected<Mesh, std::string>
+parse_range(std::string_view text, std::size_t first, std::size_t count, const ParseOptions& options = {});
+
+/// parse_range() over a memory mapping of `path`
+[[nodiscard]] std::expected<Mesh, std::string>
+parse_range(const std::filesystem::path& path, std::size_t first, std::size_t count,
+            const ParseOptions& options = {});
+
+/// Write `mesh` as binary STL. Records take their attribute word from
+/// mesh.attributes when it has one per triangle, else `attribute_byte_count`;
+/// the same holds for the other serializers. A mesh of more than 2^32 - 1
+/// triangles does not fit the format's count and is refused.
 bool serialize(std::ostream& os,
                       const Mesh& mesh,
-                      std::string_view header,
-                      std::uint16_t attribute_byte_count);
+                      std::string_view header = {},
+                      std::uint16_t attribute_byte_count = 0);
+
+/// As above; large meshes are encoded on `options.threads` threads into
+/// disjoint slices of an output block, which is written in record order
+bool serialize(std::ostream& os,
+               const Mesh& mesh,
+               const SerializeOptions& options,
+               std::string_view header = {},
+               std::uint16_t attribute_byte_count = 0);
+
+/// Bytes serialize() produces for `triangle_count` triangles
+[[nodiscard]] constexpr std::size_t serialized_size(std::size_t triangle_count) noexcept {
+    return prefix_size + triangle_count * record_size;
+}
+[[nodiscard]] inline std::size_t serialized_size(const Mesh& mesh) noexcept {
+    return serialized_size(mesh.tris.size());
+}
+
+/// Encode into `out`, which must hold at least serialized_size(mesh) bytes;
+/// returns the number of bytes written
+[[nodiscard]] std::expected<std::size_t, std::string>
+serialize(std::span<std::byte> out,
+          const Mesh& mesh,
+          std::string_view header = {},
+          std::uint16_t attribute_byte_count = 0,
+          const SerializeOptions& options = {});
+
+/// Encode into a new buffer of exactly serialized_size(mesh) bytes (empty
+/// when the mesh is refused)
+[[nodiscard]] std::vector<std::byte>
+serialize(const Mesh& mesh,
+          std::string_view header = {},
+          std::uint16_t attribute_byte_count = 0,
+          const SerializeOptions& options = {});
+
+/// VisCAM / SolidView face colour: 5 bits per channel (0..31)
+struct Color {
+    std::uint8_t r = 0, g = 0, b = 0;
+    friend bool operator==(const Color&, const Color&) = default;
+};
+
+/// Colour in an attribute word: blue in bits 0-4, green 5-9, red 10-14;
+/// bit 15 marks it valid
+[[nodiscard]] constexpr std::optional<Color> decode_color(std::uint16_t attribute) noexcept {
+    if (!(attribute & 0x8000u)) return std::nullopt;
+    return Color{static_cast<std::uint8_t>(attribute >> 10 & 31u), static_cast<std::uint8_t>(attribute >> 5 & 31u),
+                 static_cast<std::uint8_t>(attribute & 31u)};
+}
+
+/// Attribute word for `color` (channels above 31 are masked)
+[[nodiscard]] constexpr std::uint16_t encode_color(Color color) noexcept {
+    return static_cast<std::uint16_t>(0x8000u | (color.r & 31u) << 10 | (color.g & 31u) << 5 | (color.b & 31u));
+}
+
+/// Mesh name stored in an 80-byte header (trailing NULs/spaces trimmed)
+[[nodiscard]] std::string header_name(std::span<const std::byte, header_size> header);
 
 // ---- LE load/store helpers (templates must be in header) ----
 template <class T>
@@ -74,10 +193,153 @@ inline bool read_exact(std::istream& is, std::span<std::byte> buf) {
     return true;
 }
 
+/// Bytes between the read position and the end of `is`; std::nullopt when
+/// the stream cannot seek. The position and state are left as they were.
+inline std::optional<std::size_t> remaining_bytes(std::istream& is) {
+    const auto state = is.rdstate();
+    const std::istream::pos_type here = is.tellg();
+    if (here == std::istream::pos_type(-1)) {
+        is.clear(state);
+        return std::nullopt;
+    }
+    is.seekg(0, std::ios::end);
+    const std::istream::pos_type end = is.tellg();
+    is.clear(state);
+    is.seekg(here);
+    if (end == std::istream::pos_type(-1) || end < here) return std::nullopt;
+    return static_cast<std::size_t>(end - here);
+}
+
 inline bool write_exact(std::ostream& os, std::span<const std::byte> buf) {
     os.write(reinterpret_cast<const char*>(buf.data()),
              static_cast<std::streamsize>(buf.size()));
     return static_cast<bool>(os);
 }
 
+// ---- record encoding / decoding ----
+// A record is the 12 floats of a Triangle followed by the 2 attribute bytes.
+static_assert(sizeof(Triangle) == 12 * sizeof(float));
+static_assert(std::is_trivially_copyable_v<Triangle>);
+
+/// Decode one 50-byte record (attribute bytes are not part of the Triangle)
+[[nodiscard]] inline Triangle decode_record(const std::byte* rec) noexcept {
+    Triangle t;
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(&t, rec, sizeof(Triangle));
+    } else {
+        float vals[12];
+        for (std::size_t k = 0; k < 12; ++k)
+            vals[k] = load_le<float>(std::span<const std::byte, 4>{rec + k * 4, 4});
+        std::memcpy(&t, vals, sizeof(Triangle));
+    }
+    return t;
+}
+
+/// Encode one 50-byte record: the 12 floats of `t`, then the attribute bytes
+inline void encode_record(const Triangle& t, std::uint16_t attribute_byte_count, std::byte* rec) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(rec, &t, sizeof(Triangle));
+    } else {
+        float vals[12];
+        std::memcpy(vals, &t, sizeof(Triangle));
+        for (std::size_t k = 0; k < 12; ++k)
+            store_le<float>(vals[k], std::span<std::byte, 4>{rec + k * 4, 4});
+    }
+    store_le<std::uint16_t>(attribute_byte_count, std::span<std::byte, 2>{rec + 48, 2});
+}
+
+/// Lazy random-access view over the records of a binary STL buffer.
+/// Triangles are decoded on access; nothing is copied up front. The view
+/// does not own the bytes: keep the buffer (or MappedFile) alive.
+class View : public std::ranges::view_interface<View> {
+public:
+    class iterator {
+    public:
+        using iterator_concept  = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag; // yields prvalues
+        using value_type        = Triangle;
+        using difference_type   = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(const std::byte* rec) noexcept : rec_(rec) {}
+
+        Triangle operator*() const noexcept { return decode_record(rec_); }
+        Triangle operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        iterator& operator++() noexcept { rec_ += record_size; return *this; }
+        iterator operator++(int) noexcept { auto tmp = *this; ++*this; return tmp; }
+        iterator& operator--() noexcept { rec_ -= record_size; return *this; }
+        iterator operator--(int) noexcept { auto tmp = *this; --*this; return tmp; }
+
+        iterator& operator+=(difference_type n) noexcept {
+            rec_ += n * static_cast<difference_type>(record_size);
+            return *this;
+        }
+        iterator& operator-=(difference_type n) noexcept { return *this += -n; }
+
+        friend iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+        friend iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+        friend iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const iterator& a, const iterator& b) noexcept {
+            return (a.rec_ - b.rec_) / static_cast<difference_type>(record_size);
+        }
+
+        friend bool operator==(const iterator&, const iterator&) = default;
+        friend auto operator<=>(const iterator&, const iterator&) = default;
+
+    private:
+        const std::byte* rec_ = nullptr;
+    };
+
+    View() = default;
+
+    /// Validate header and payload length; fails with the same messages as parse()
+    [[nodiscard]] static std::expected<View, std::string> open(std::string_view bytes) noexcept {
+        if (bytes.size() < header_size)
+            return std::unexpected(std::string("Binary STL: failed to read 80-byte header"));
+        if (bytes.size() < prefix_size)
+            return std::unexpected(std::string("Binary STL: failed to read triangle count"));
+        const auto* base = reinterpret_cast<const std::byte*>(bytes.data());
+        const std::uint32_t count =
+            load_le<std::uint32_t>(std::span<const std::byte, 4>(base + header_size, 4));
+        if ((bytes.size() - prefix_size) / record_size < count)
+            return std::unexpected(std::string("Binary STL: unexpected EOF in triangle data"));
+        return View(base, count);
+    }
+
+    [[nodiscard]] iterator begin() const noexcept { return iterator(records()); }
+    [[nodiscard]] iterator end() const noexcept { return iterator(records() + count_ * record_size); }
+
+    /// Triangle count taken from the header
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+
+    [[nodiscard]] Triangle operator[](std::size_t i) const noexcept {
+        return decode_record(records() + i * record_size);
+    }
+
+    /// The 2-byte attribute field of record `i`
+    [[nodiscard]] std::uint16_t attribute(std::size_t i) const noexcept {
+        return load_le<std::uint16_t>(
+            std::span<const std::byte, 2>(records() + i * record_size + 48, 2));
+    }
+
+    /// All zero for a default-constructed view
+    [[nodiscard]] std::span<const std::byte, header_size> header() const noexcept {
+        static constexpr std::byte blank[header_size]{};
+        return std::span<const std::byte, header_size>(base_ ? base_ : blank, header_size);
+    }
+
+    [[nodiscard]] std::string name() const { return header_name(header()); }
+
+private:
+    View(const std::byte* base, std::size_t count) noexcept : base_(base), count_(count) {}
+
+    // Null for a default-constructed view, which has no records to offset into
+    const std::byte* records() const noexcept { return base_ ? base_ + prefix_size : nullptr; }
+
+    const std::byte* base_ = nullptr;
+    std::size_t count_ = 0;
+};
+
 } // namespace Harmony::STL::Binary
+
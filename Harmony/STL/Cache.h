@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "BVH.h"
+#include "IndexedMesh.h"
+#include "Mesh.h"
+#include "Options.h"
+
+namespace Harmony::STL {
+
+/// Block compression of the mesh cache. A codec is only usable when the
+/// library was built with it (see codec_available()); saving with one that
+/// is missing stores the blocks uncompressed.
+enum class CacheCodec : std::uint8_t { none = 0, lz4 = 1, zstd = 2 };
+
+[[nodiscard]] bool codec_available(CacheCodec codec) noexcept;
+
+struct CacheOptions {
+    /// Welding distance for Mesh input (0 = bit-exact, see weld())
+    float weld_epsilon = 0.0f;
+    /// Store positions as 16 bits per axis within the bounds (lossy)
+    bool quantize_positions = false;
+    /// Store per-face normals; without them they are recomputed on load
+    bool store_normals = true;
+    /// Store normals octahedron-encoded in 2 x 16 bits (lossy)
+    bool oct_normals = false;
+    CacheCodec codec = CacheCodec::lz4;
+    /// Codec compression level; 0 = the codec's default
+    int level = 0;
+    /// Vertices / faces per independently decodable block
+    std::size_t block_items = std::size_t{1} << 16;
+    /// Encode and decode threads: 1 = serial, 0 = hardware concurrency
+    unsigned threads = 1;
+
+    /// load_cached(): where caches live; unset = next to the source as "<file>.hmc"
+    std::optional<std::filesystem::path> directory;
+    /// load_cached(): also compare a hash of the source contents, not just size and mtime
+    bool verify_hash = false;
+    /// load_cached(): how the source is parsed on a miss
+    ParseOptions parse;
+};
+
+/// Header of a cache file: counts, bounds and the source it was built from
+struct CacheInfo {
+    std::uint64_t vertex_count = 0;
+    std::uint64_t face_count = 0;
+    Vec3 min{}, max{}; ///< bounds of the vertices
+    bool quantized_positions = false;
+    bool has_normals = false;
+    bool oct_normals = false;
+    float weld_epsilon = 0.0f;            ///< CacheOptions::weld_epsilon it was saved with
+    bool compute_missing_normals = false; ///< the source's ParseOptions::compute_missing_normals
+    std::uint64_t source_size = 0;  ///< 0 when saved without a source
+    std::int64_t source_mtime = 0;  ///< nanoseconds of the file clock
+    std::uint64_t source_hash = 0;
+};
+
+/// Encode `mesh` into the cache format; `source` is recorded in the header
+[[nodiscard]] std::expected<std::vector<std::byte>, std::string>
+encode_cache(const IndexedMesh& mesh, const CacheOptions& options = {},
+             const CacheInfo& source = {});
+
+/// Decode a whole cache buffer (e.g. a MappedFile)
+[[nodiscard]] std::expected<IndexedMesh, std::string>
+decode_cache(std::span<const std::byte> bytes, unsigned threads = 1);
+
+/// Read just the header of a cache buffer
+[[nodiscard]] std::expected<CacheInfo, std::string>
+cache_info(std::span<const std::byte> bytes);
+
+[[nodiscard]] std::expected<void, std::string>
+save_cache(const std::filesystem::path& path, const IndexedMesh& mesh, const CacheOptions& options = {});
+
+/// Welds `mesh` with options.weld_epsilon first
+[[nodiscard]] std::expected<void, std::string>
+save_cache(const std::filesystem::path& path, const Mesh& mesh, const CacheOptions& options = {});
+
+/// Memory-map a cache file and decode its blocks on `threads` threads
+[[nodiscard]] std::expected<IndexedMesh, std::string>
+load_cache(const std::filesystem::path& path, unsigned threads = 1);
+
+/// Where load_cached() keeps the cache of `source`
+[[nodiscard]] std::filesystem::path
+cache_path(const std::filesystem::path& source, const CacheOptions& options = {});
+
+/// Load an STL file through its cache: a cache matching the source's size
+/// and modification time (and hash, if asked), and saved with the same
+/// storage, welding and parse-normal options, is decoded; otherwise the
+/// source is parsed and the cache (re)built. Failing to write the cache is
+/// not an error. Lossy options give the same mesh on the first load as on
+/// reloads.
+[[nodiscard]] std::expected<Mesh, std::string>
+load_cached(const std::filesystem::path& source, const CacheOptions& options = {});
+
+struct CachedMesh {
+    Mesh mesh;
+    BVH bvh; ///< face indices refer to mesh.tris
+};
+
+/// load_cached() plus a BVH over the mesh, kept in "<cache>.bvh" next to
+/// the cache under the same source key. The build options are not part of
+/// the key: a BVH cached with other options is reused.
+[[nodiscard]] std::expected<CachedMesh, std::string>
+load_cached_with_bvh(const std::filesystem::path& source, const CacheOptions& options = {},
+                     const BVH::BuildOptions& bvh_options = {});
+
+} // namespace Harmony::STL
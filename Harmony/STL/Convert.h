@@ -0,0 +1,38 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <iosfwd>
+#include <string>
+
+#include "Format.h"
+#include "Options.h"
+
+namespace Harmony::STL {
+
+/// Convert `in` (either format, detected) to `to`, piping a Reader into a
+/// Writer a batch at a time, so memory stays bounded whatever the size.
+/// The output matches parse() followed by ASCII::serialize(mesh, options)
+/// or Binary::serialize(os, mesh, options, mesh.name): the solid name
+/// carries over and zero normals are computed. ASCII input to binary
+/// output needs a seekable `out` for the header count. Unlike parse(), an
+/// ASCII line of Reader::default_max_line_bytes or more is an error. Returns
+/// the number of triangles converted.
+[[nodiscard]] std::expected<std::size_t, std::string>
+convert(std::istream& in, std::ostream& out, Format to, const SerializeOptions& options = {});
+
+/// File to file; `output` is created or truncated and must not be `input`
+[[nodiscard]] std::expected<std::size_t, std::string>
+convert(const std::filesystem::path& input, const std::filesystem::path& output, Format to,
+        const SerializeOptions& options = {});
+
+} // namespace Harmony::STL
@@ -0,0 +1,33 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace Harmony::STL {
+
+enum class Format { ascii, binary };
+
+/// Decide the format from the first bytes of a file (`head`, ideally at
+/// least the 84-byte binary prefix) and its total size when known:
+///  1. a size of exactly 84 + 50 * count is binary, even if the header
+///     starts with "solid" (many exporters write that);
+///  2. anything not starting with "solid" is binary;
+///  3. a "solid" start followed by NUL or other control bytes is binary;
+///  4. everything else is ASCII.
+[[nodiscard]] Format detect_format(std::string_view head, std::optional<std::size_t> total_size) noexcept;
+
+/// Detection on a whole file held in memory (e.g. a MappedFile)
+[[nodiscard]] inline Format detect_format(std::string_view bytes) noexcept {
+    return detect_format(bytes, bytes.size());
+}
+
+} // namespace Harmony::STL
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Mesh.h"
+
+namespace Harmony::STL {
+
+/// Shared-vertex mesh: unique positions plus three indices per face
+struct IndexedMesh {
+    std::string name;
+    std::vector<Vec3> vertices;
+    std::vector<std::array<std::uint32_t,3>> indices;
+    std::vector<Vec3> normals; // per face; empty -> recomputed on expansion
+};
+
+/// Weld coincident vertices of a triangle soup (hash based, O(n)).
+/// With `epsilon > 0` positions are snapped to a grid of that cell size
+/// before hashing, so vertices within the same cell are merged; the first
+/// position seen in a cell is kept. Face normals are dropped unless
+/// `keep_normals` is set. Throws std::length_error past 2^32 vertices.
+[[nodiscard]] IndexedMesh weld(const Mesh& mesh, float epsilon = 0.0f, bool keep_normals = false);
+
+struct CleanupOptions {
+    /// Vertex welding cell as in weld(); faces that are then identical up
+    /// to rotation are epsilon-duplicates
+    float weld_epsilon = 0.0f;
+    /// Drop faces with a repeated vertex or an area <= min_area (NaN too)
+    bool remove_degenerate = true;
+    float min_area = 0.0f;
+    /// Drop faces over the same three vertices as an earlier one
+    bool remove_duplicates = true;
+    /// Only count same-winding faces as duplicates (keeps two-sided walls)
+    bool respect_winding = false;
+    bool keep_normals = false;
+    /// 1 = serial, 0 = hardware concurrency
+    unsigned threads = 1;
+};
+
+struct CleanupStats {
+    std::size_t degenerate = 0;
+    std::size_t duplicates = 0;
+    std::size_t unused_vertices = 0; ///< welded vertices only removed faces used
+};
+
+/// Weld, then remove degenerate and duplicate faces. Corners and faces are
+/// radix-partitioned by hash and each partition deduplicated on its own,
+/// so the work is spread over threads and the result does not depend on
+/// them. Surviving faces keep their order; vertices are numbered by first
+/// use. Without removals the result equals weld(). Throws
+/// std::length_error past 2^32 - 1 corners.
+[[nodiscard]] IndexedMesh clean(const Mesh& mesh, const CleanupOptions& options = {},
+                                CleanupStats* stats = nullptr);
+
+/// Expand back to a triangle soup (normals from `normals` or face_normal)
+[[nodiscard]] Mesh expand(const IndexedMesh& mesh);
+
+} // namespace Harmony::STL
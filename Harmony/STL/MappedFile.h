@@ -0,0 +1,58 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace Harmony::STL {
+
+/// Read-only memory mapping of a whole file (mmap / CreateFileMapping).
+/// Move-only; the mapping is released when the object is destroyed.
+class MappedFile {
+public:
+    MappedFile() noexcept = default;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    /// Map `path` read-only. Empty files yield an empty mapping.
+    [[nodiscard]] static std::expected<MappedFile, std::string>
+    open(const std::filesystem::path& path);
+
+    [[nodiscard]] const std::byte* data() const noexcept { return data_; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /// The mapped bytes
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return {data_, size_}; }
+
+    /// The mapped bytes as a character buffer (for the string_view parsers)
+    [[nodiscard]] std::string_view view() const noexcept {
+        return {reinterpret_cast<const char*>(data_), size_};
+    }
+
+private:
+    void close() noexcept;
+
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+#ifdef _WIN32
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#endif
+};
+
+} // namespace Harmony::STL
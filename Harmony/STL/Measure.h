@@ -0,0 +1,60 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+#include "Mesh.h"
+#include "MeshSoA.h"
+
+namespace Harmony::STL {
+
+/// Bounds, surface area, enclosed volume and degeneracy of a set of faces.
+/// Accumulates across batches with merge(); see measure().
+struct GeometryStats {
+    std::size_t faces = 0;
+    std::size_t degenerate = 0; ///< faces of zero area (face_normal() leaves them zero)
+    /// Axis-aligned bounds of the vertices; min > max while empty
+    Vec3 min{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+             std::numeric_limits<float>::infinity()};
+    Vec3 max{-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+             -std::numeric_limits<float>::infinity()};
+    double area = 0.0;
+    /// Signed (divergence theorem): positive when a closed mesh winds outward
+    double volume = 0.0;
+
+    [[nodiscard]] bool empty() const noexcept { return faces == 0; }
+
+    void merge(const GeometryStats& other) noexcept {
+        faces += other.faces;
+        degenerate += other.degenerate;
+        min = Vec3{std::min(min.x, other.min.x), std::min(min.y, other.min.y), std::min(min.z, other.min.z)};
+        max = Vec3{std::max(max.x, other.max.x), std::max(max.y, other.max.y), std::max(max.z, other.max.z)};
+        area += other.area;
+        volume += other.volume;
+    }
+};
+
+/// One SIMD pass (same kernel selection as the normal functions) computing
+/// every GeometryStats field; NaN coordinates do not affect the bounds
+[[nodiscard]] GeometryStats measure(std::span<const Triangle> tris) noexcept;
+[[nodiscard]] GeometryStats measure(const MeshSoA& mesh) noexcept;
+
+/// measure() fused with fill_missing_normals() (or recompute_normals() when
+/// !only_missing): the normals come from the same cross products and are
+/// bit-identical to those functions'. `filled` receives how many were written.
+GeometryStats measure_and_fill_normals(std::span<Triangle> tris, bool only_missing = true,
+                                       std::size_t* filled = nullptr) noexcept;
+GeometryStats measure_and_fill_normals(MeshSoA& mesh, bool only_missing = true,
+                                       std::size_t* filled = nullptr) noexcept;
+
+} // namespace Harmony::STL
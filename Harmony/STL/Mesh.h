@@ -10,7 +10,11 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Harmony::STL {
@@ -25,11 +29,43 @@ struct Triangle {
     std::array<Vec3,3> v{};
 };
 
-struct Mesh {
-    std::string name;
-    std::vector<Triangle> tris;
+/// Triangle soup; `Allocator` (rebound to char for the name) supplies all
+/// storage, so meshes can live in an arena (see pmr::Mesh)
+template <class Allocator = std::allocator<Triangle>>
+struct BasicMesh {
+    using allocator_type = Allocator;
+    using string_type = std::basic_string<char, std::char_traits<char>,
+        typename std::allocator_traits<Allocator>::template rebind_alloc<char>>;
+
+    using attribute_vector = std::vector<std::uint16_t,
+        typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint16_t>>;
+
+    string_type name;
+    std::vector<Triangle, Allocator> tris;
+    /// Binary STL attribute word of each face (e.g. a SolidView colour, see
+    /// Binary::decode_color). Empty unless asked for with
+    /// ParseOptions::keep_attributes; otherwise one per triangle.
+    attribute_vector attributes;
+
+    BasicMesh() = default;
+    explicit BasicMesh(const Allocator& alloc) : name(alloc), tris(alloc), attributes(alloc) {}
+    // Allocator-extended copy/move, so containers of meshes propagate their arena
+    BasicMesh(const BasicMesh& other, const Allocator& alloc)
+        : name(other.name, alloc), tris(other.tris, alloc), attributes(other.attributes, alloc) {}
+    BasicMesh(BasicMesh&& other, const Allocator& alloc)
+        : name(std::move(other.name), alloc), tris(std::move(other.tris), alloc),
+          attributes(std::move(other.attributes), alloc) {}
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return tris.get_allocator(); }
 };
 
+using Mesh = BasicMesh<>;
+
+namespace pmr {
+/// Mesh drawing from a std::pmr::memory_resource, e.g. a monotonic arena
+using Mesh = BasicMesh<std::pmr::polymorphic_allocator<Triangle>>;
+}
+
 /// Utility: compute geometric normal of a triangle (right-handed)
 [[nodiscard]] inline Vec3 face_normal(const Triangle& t) {
     auto sub = [](const Vec3& a, const Vec3& b){ return Vec3{a.x-b.x, a.y-b.y, a.z-b.z}; };
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Mesh.h"
+
+namespace Harmony::STL {
+
+/// Allocator returning `Align`-byte aligned storage (for full-width SIMD loads)
+template <class T, std::size_t Align = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <class U>
+    struct rebind { using other = AlignedAllocator<U, Align>; };
+
+    AlignedAllocator() noexcept = default;
+    template <class U>
+    AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Align}));
+    }
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t{Align});
+    }
+
+    template <class U>
+    friend bool operator==(const AlignedAllocator&, const AlignedAllocator<U, Align>&) noexcept { return true; }
+};
+
+using FloatArray = std::vector<float, AlignedAllocator<float>>;
+
+/// Three contiguous component arrays
+struct Vec3Array {
+    FloatArray x, y, z;
+
+    [[nodiscard]] std::size_t size() const noexcept { return x.size(); }
+    void resize(std::size_t n) { x.resize(n); y.resize(n); z.resize(n); }
+    void reserve(std::size_t n) { x.reserve(n); y.reserve(n); z.reserve(n); }
+    void clear() noexcept { x.clear(); y.clear(); z.clear(); }
+
+    void push_back(const Vec3& p) { x.push_back(p.x); y.push_back(p.y); z.push_back(p.z); }
+    void set(std::size_t i, const Vec3& p) noexcept { x[i] = p.x; y[i] = p.y; z[i] = p.z; }
+    [[nodiscard]] Vec3 operator[](std::size_t i) const noexcept { return Vec3{x[i], y[i], z[i]}; }
+};
+
+/// Structure-of-arrays triangle soup: one component array per vertex slot
+/// and for the normals, so batch kernels run on unit-stride data.
+struct MeshSoA {
+    std::string name;
+    Vec3Array normal;
+    std::array<Vec3Array,3> v;
+
+    [[nodiscard]] std::size_t size() const noexcept { return normal.size(); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    void resize(std::size_t n) { normal.resize(n); for (auto& a : v) a.resize(n); }
+    void reserve(std::size_t n) { normal.reserve(n); for (auto& a : v) a.reserve(n); }
+    void clear() noexcept { normal.clear(); for (auto& a : v) a.clear(); }
+
+    void push_back(const Triangle& t) {
+        normal.push_back(t.normal);
+        for (std::size_t k = 0; k < 3; ++k) v[k].push_back(t.v[k]);
+    }
+    void set(std::size_t i, const Triangle& t) noexcept {
+        normal.set(i, t.normal);
+        for (std::size_t k = 0; k < 3; ++k) v[k].set(i, t.v[k]);
+    }
+    [[nodiscard]] Triangle operator[](std::size_t i) const noexcept {
+        return Triangle{ normal[i], { v[0][i], v[1][i], v[2][i] } };
+    }
+};
+
+/// Transpose a triangle soup into SoA form (one pass, no intermediate copy)
+[[nodiscard]] MeshSoA to_soa(const Mesh& mesh);
+
+/// Transpose back to array-of-structs
+[[nodiscard]] Mesh to_mesh(const MeshSoA& mesh);
+
+} // namespace Harmony::STL
@@ -0,0 +1,35 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+#include "Mesh.h"
+#include "MeshSoA.h"
+
+namespace Harmony::STL {
+
+// Batch counterparts of face_normal(). The kernel (AVX-512, AVX2, SSE2,
+// NEON or scalar) is picked once at runtime from the CPU features; every
+// kernel performs the same operations as face_normal() lane by lane.
+
+/// Recompute the normal of every face
+void recompute_normals(std::span<Triangle> tris) noexcept;
+void recompute_normals(MeshSoA& mesh) noexcept;
+
+/// Fill only all-zero normals (|nx|+|ny|+|nz| < 1e-20); returns how many
+std::size_t fill_missing_normals(std::span<Triangle> tris) noexcept;
+std::size_t fill_missing_normals(MeshSoA& mesh) noexcept;
+
+/// Name of the kernel selected for this CPU ("avx512", "avx2", "sse2", "neon", "scalar")
+[[nodiscard]] std::string_view normals_kernel() noexcept;
+
+} // namespace Harmony::STL
@@ -0,0 +1,47 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+
+namespace Harmony::STL {
+
+struct GeometryStats;
+
+/// Options accepted by the buffer parsers
+struct ParseOptions {
+    bool compute_missing_normals = true;
+    /// Worker threads for large inputs: 1 = serial, 0 = hardware concurrency
+    unsigned threads = 1;
+    /// When set, receives measure() of the parsed faces, computed in the
+    /// pass that fills missing normals (per chunk when threaded). Concurrent
+    /// parses each need their own.
+    GeometryStats* geometry = nullptr;
+    /// Binary: keep each record's attribute word in Mesh::attributes
+    /// (decoded in the same pass as the triangles)
+    bool keep_attributes = false;
+    /// Largest mesh, in bytes, a parse may allocate (0 = no limit). Larger
+    /// inputs fail before anything is allocated for them; read those with
+    /// Reader, Binary::View or Binary::ProgressiveLoader instead. ASCII
+    /// input that fits only once is parsed serially rather than chunked, as
+    /// the chunked parser holds every facet twice while merging.
+    std::size_t memory_limit = 0;
+};
+
+/// Options accepted by the serializers
+struct SerializeOptions {
+    /// Worker threads for large meshes: 1 = serial, 0 = hardware concurrency
+    unsigned threads = 1;
+    /// ASCII: digits after the decimal point (fixed notation)
+    int float_precision = 6;
+    /// ASCII: shortest text that reads back to the same float (ignores precision)
+    bool shortest_round_trip = false;
+};
+
+} // namespace Harmony::STL
@@ -9,15 +9,68 @@
 #pragma once
 
 #include <expected>
+#include <filesystem>
 #include <iosfwd>
+#include <span>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "Mesh.h"
 #include "Ascii.h"
 #include "Binary.h"
+#include "Format.h"
+#include "Options.h"
 
 namespace Harmony::STL {
 
-    std::expected<Mesh, std::string> parse(std::istream& is, bool compute_missing_normals);
+    /// Detect the format (see detect_format()) and parse; the stream is read
+    /// once and does not have to be seekable
+    std::expected<Mesh, std::string> parse(std::istream& is, bool compute_missing_normals = true);
 
-} // namespace Harmony::STL
\ No newline at end of file
+    /// Detect the format of a whole buffer and run exactly one parser on it
+    [[nodiscard]] std::expected<Mesh, std::string>
+    parse(std::string_view bytes, bool compute_missing_normals = true) noexcept;
+
+    [[nodiscard]] std::expected<Mesh, std::string>
+    parse(std::string_view bytes, const ParseOptions& options);
+
+    /// Detect the format and run that parser's parse<Config>()
+    template <ParseConfig Config>
+    [[nodiscard]] std::expected<ParsedMesh<Config>, std::string> parse(std::string_view bytes) {
+        if (detect_format(bytes) == Format::binary) return Binary::parse<Config>(bytes);
+        return ASCII::parse<Config>(bytes);
+    }
+
+    /// Detect and parse into `mesh`, reusing its capacity
+    [[nodiscard]] std::expected<void, std::string>
+    parse_into(std::string_view bytes, Mesh& mesh, const ParseOptions& options = {});
+
+    /// As above, with the mesh storage taken from `resource`
+    [[nodiscard]] std::expected<pmr::Mesh, std::string>
+    parse(std::string_view bytes, std::pmr::memory_resource* resource,
+          bool compute_missing_normals = true) noexcept;
+
+    /// Memory-map `path`, detect its format and parse the mapping
+    [[nodiscard]] std::expected<Mesh, std::string>
+    load(const std::filesystem::path& path, bool compute_missing_normals = true);
+
+    [[nodiscard]] std::expected<Mesh, std::string>
+    load(const std::filesystem::path& path, const ParseOptions& options);
+
+    /// Options for load_many()
+    struct LoadManyOptions {
+        /// Worker threads: 0 = hardware concurrency
+        unsigned threads = 0;
+        /// Applied to every file; `threads` and `geometry` are ignored
+        ParseOptions options;
+    };
+
+    /// load() every path, on one work-stealing pool: files are started
+    /// largest first, small ones run whole and large ones split into
+    /// chunks (ASCII) or record slices (binary) that idle workers steal.
+    /// Results are in input order, each holding its mesh or load()'s error.
+    [[nodiscard]] std::vector<std::expected<Mesh, std::string>>
+    load_many(std::span<const std::filesystem::path> paths, const LoadManyOptions& options = {});
+
+} // namespace Harmony::STL
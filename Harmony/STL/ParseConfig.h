@@ -0,0 +1,45 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "Mesh.h"
+#include "MeshSoA.h"
+
+namespace Harmony::STL {
+
+enum class NormalPolicy : std::uint8_t {
+    keep,         ///< normals as stored in the file
+    fill_missing, ///< compute the all-zero ones (the runtime default)
+    recompute,    ///< compute every one; ASCII does not even read the stored ones
+};
+
+enum class MeshLayout : std::uint8_t { aos, soa };
+
+/// Parse configuration fixed at compile time, for parse<Config>(): each
+/// one is its own specialised code path, with no per-facet option tests.
+/// Every combination is instantiated in the library.
+struct ParseConfig {
+    NormalPolicy normals = NormalPolicy::fill_missing;
+    /// ASCII: check keywords and facet structure line by line. When off,
+    /// facets are read by token position alone: misspelt keywords go
+    /// unnoticed, but bad numbers, truncation and layouts the fast path
+    /// does not follow still go through the checking parser (and its
+    /// errors). Binary input is always bounds-checked.
+    bool validate = true;
+    MeshLayout layout = MeshLayout::aos;
+};
+
+/// Mesh type parse<Config>() returns
+template <ParseConfig Config>
+using ParsedMesh = std::conditional_t<Config.layout == MeshLayout::soa, MeshSoA, Mesh>;
+
+} // namespace Harmony::STL
@@ -0,0 +1,52 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <expected>
+#include <filesystem>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+#include "Mesh.h"
+#include "Options.h"
+
+namespace Harmony::STL {
+
+/// Reusable parser for queues of files: the read buffer it owns and the
+/// capacity of the caller's Mesh carry over from one call to the next, so
+/// after warm-up a file of similar size parses without allocating.
+/// Not thread-safe; use one Parser per worker.
+class Parser {
+public:
+    Parser() = default;
+    explicit Parser(const ParseOptions& options) : options_(options) {}
+
+    [[nodiscard]] const ParseOptions& options() const noexcept { return options_; }
+    void set_options(const ParseOptions& options) noexcept { options_ = options; }
+
+    /// Detect the format and parse `bytes` into `mesh`
+    [[nodiscard]] std::expected<void, std::string> parse_into(std::string_view bytes, Mesh& mesh);
+
+    /// Read the stream into the reusable buffer and parse it into `mesh`
+    [[nodiscard]] std::expected<void, std::string> parse_into(std::istream& is, Mesh& mesh);
+
+    /// Parse a file into `mesh`: small files are read into the reusable
+    /// buffer, large ones are memory-mapped
+    [[nodiscard]] std::expected<void, std::string> load_into(const std::filesystem::path& path, Mesh& mesh);
+
+    /// Bytes currently reserved for reading
+    [[nodiscard]] std::size_t buffer_capacity() const noexcept { return buffer_.capacity(); }
+
+private:
+    ParseOptions options_;
+    std::string buffer_;
+};
+
+} // namespace Harmony::STL
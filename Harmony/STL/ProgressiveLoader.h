@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Mesh.h"
+
+namespace Harmony::STL::Binary {
+
+/// Consecutive triangles of a file, tris[0] being triangle `first`
+struct TriangleRange {
+    std::size_t first = 0;
+    std::vector<Triangle> tris;
+};
+
+/// Delivers a binary STL file front to back in ranges while background
+/// threads decode the ranges after it, so the first triangles can be shown
+/// long before the file is through. The file is memory-mapped; a range
+/// only pages in its own records. Ranges start small and double, so the
+/// first arrives quickly and the rest have little overhead. Move-only; the
+/// destructor stops the decoding.
+class ProgressiveLoader {
+public:
+    struct Config {
+        /// Triangles in the first range
+        std::size_t first_range = 4096;
+        /// Ranges double up to this many triangles
+        std::size_t max_range = std::size_t{1} << 20;
+        /// Decoding threads: 0 = hardware concurrency
+        unsigned threads = 1;
+        /// Decoding pauses while this many ranges wait for next()
+        std::size_t max_ready = 4;
+        bool compute_missing_normals = true;
+    };
+
+    ProgressiveLoader(ProgressiveLoader&& other) noexcept;
+    ProgressiveLoader& operator=(ProgressiveLoader&& other) noexcept;
+    ProgressiveLoader(const ProgressiveLoader&) = delete;
+    ProgressiveLoader& operator=(const ProgressiveLoader&) = delete;
+    ~ProgressiveLoader();
+
+    /// Map `path`, validate it as Binary::parse() does and start decoding
+    [[nodiscard]] static std::expected<ProgressiveLoader, std::string> open(const std::filesystem::path& path);
+    [[nodiscard]] static std::expected<ProgressiveLoader, std::string>
+    open(const std::filesystem::path& path, const Config& config);
+
+    /// The next range in file order, waiting for it to be decoded;
+    /// std::nullopt after the last
+    [[nodiscard]] std::optional<TriangleRange> next();
+
+    /// Triangle count from the header
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] const std::string& name() const noexcept;
+    /// Triangles handed out by next() so far
+    [[nodiscard]] std::size_t delivered() const noexcept;
+
+private:
+    struct State;
+    explicit ProgressiveLoader(std::unique_ptr<State> state) noexcept;
+
+    std::unique_ptr<State> state_;
+};
+
+} // namespace Harmony::STL::Binary
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Format.h"
+#include "Measure.h"
+#include "Mesh.h"
+
+namespace Harmony::STL {
+
+/// Pull-based STL reader with bounded memory: triangles are handed out in
+/// caller-sized batches while the input is read a block at a time, so files
+/// larger than RAM can be processed. Move-only.
+class Reader {
+public:
+    /// ASCII lines of this many bytes or more fail instead of being buffered
+    /// whole, so input without newlines cannot grow memory without bound
+    static constexpr std::size_t default_max_line_bytes = 1024 * 1024;
+
+    Reader(Reader&& other) noexcept;
+    Reader& operator=(Reader&& other) noexcept;
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+    ~Reader();
+
+    /// Detect the format with detect_format() and read the binary header.
+    /// The size check needs a seekable stream; otherwise only the first bytes
+    /// decide. `is` must outlive the reader.
+    [[nodiscard]] static std::expected<Reader, std::string>
+    open(std::istream& is, bool compute_missing_normals = true);
+
+    /// As above with the format given instead of detected
+    [[nodiscard]] static std::expected<Reader, std::string>
+    open(std::istream& is, Format format, bool compute_missing_normals = true);
+
+    /// Open `path` for reading (the reader owns the file stream)
+    [[nodiscard]] static std::expected<Reader, std::string>
+    open(const std::filesystem::path& path, bool compute_missing_normals = true);
+
+    /// Fill the front of `out` with the next triangles; returns how many were
+    /// written, 0 once the input is exhausted. Errors use the parse() messages
+    /// (including ASCII line numbers) and are sticky.
+    [[nodiscard]] std::expected<std::size_t, std::string> next_batch(std::span<Triangle> out);
+
+    [[nodiscard]] Format format() const noexcept;
+
+    /// Binary: header name. ASCII: name from the most recent 'solid' line so far.
+    [[nodiscard]] const std::string& name() const noexcept;
+
+    /// Triangle count announced by a binary header
+    [[nodiscard]] std::optional<std::size_t> expected_count() const noexcept;
+
+    /// True once next_batch() has returned 0 or an error
+    [[nodiscard]] bool done() const noexcept;
+
+    /// Measure every batch handed out from now on, in the pass that fills
+    /// missing normals; the running totals are in geometry()
+    void measure_geometry(bool enable = true) noexcept;
+    [[nodiscard]] const GeometryStats& geometry() const noexcept;
+
+    /// Cap ASCII lines at `max_bytes` from now on (default_max_line_bytes
+    /// until changed); 0 lifts the cap. The whole-mesh parse(std::istream&)
+    /// overloads lift it, so they accept what the buffer parsers accept.
+    void limit_line_length(std::size_t max_bytes) noexcept;
+
+private:
+    struct State;
+    explicit Reader(std::unique_ptr<State> state) noexcept;
+
+    std::unique_ptr<State> state_;
+};
+
+/// Read everything that is left into a Mesh (named after the input)
+[[nodiscard]] std::expected<Mesh, std::string> read_mesh(Reader& reader);
+
+/// Push-style driver: calls fn(std::span<const Triangle>) for every batch of
+/// at most `batch_size` triangles; returns the total number of triangles.
+template <class Fn>
+std::expected<std::size_t, std::string>
+for_each_batch(Reader& reader, std::size_t batch_size, Fn&& fn) {
+    std::vector<Triangle> batch(batch_size ? batch_size : 1);
+    std::size_t total = 0;
+    for (;;) {
+        auto n = reader.next_batch(batch);
+        if (!n) return std::unexpected(std::move(n.error()));
+        if (*n == 0) return total;
+        fn(std::span<const Triangle>(batch.data(), *n));
+        total += *n;
+    }
+}
+
+} // namespace Harmony::STL
@@ -0,0 +1,57 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+// Set by the HARMONY_ENABLE_STATS CMake option; without it every
+// instrumentation point compiles to nothing
+#ifndef HARMONY_ENABLE_STATS
+    #define HARMONY_ENABLE_STATS 0
+#endif
+
+namespace Harmony::STL {
+
+inline constexpr bool stats_enabled = HARMONY_ENABLE_STATS != 0;
+
+/// Counters and per-phase wall time of one parse or serialize call. Phases
+/// do not overlap, so total minus their sum is the untimed remainder
+/// (setup, copies). Work done on helper threads (threads != 1) is counted
+/// in the caller's phase around it, without the per-line counters.
+struct Stats {
+    std::uint64_t bytes_read = 0;       ///< input consumed (buffer or stream)
+    std::uint64_t bytes_written = 0;    ///< serializer output
+    std::uint64_t lines = 0;            ///< ASCII lines scanned
+    std::uint64_t facets = 0;           ///< triangles parsed or written
+    std::uint64_t normals_computed = 0; ///< zero normals replaced
+    std::uint64_t slow_floats = 0;      ///< ASCII numbers that missed the fast path
+    std::uint64_t reallocations = 0;    ///< growths of the triangle storage
+
+    std::chrono::nanoseconds total{};
+    std::chrono::nanoseconds io{};      ///< stream reads and writes
+    std::chrono::nanoseconds scan{};    ///< ASCII tokenising and number parsing
+    std::chrono::nanoseconds decode{};  ///< binary record decoding
+    std::chrono::nanoseconds normals{}; ///< normal recomputation
+    std::chrono::nanoseconds encode{};  ///< text formatting / record encoding
+};
+
+/// Stats of the most recent top-level call on this thread (all zero when
+/// the library was built without HARMONY_ENABLE_STATS)
+[[nodiscard]] Stats last_stats() noexcept;
+
+/// Called on the calling thread after every top-level instrumented call
+/// with its name (e.g. "ASCII::parse") and stats. Must not throw; an empty
+/// function removes the hook.
+using StatsHook = std::function<void(std::string_view operation, const Stats& stats)>;
+void set_stats_hook(StatsHook hook);
+
+} // namespace Harmony::STL
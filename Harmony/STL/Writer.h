@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Format.h"
+#include "Mesh.h"
+#include "Options.h"
+
+namespace Harmony::STL {
+
+/// Push-based STL writer with bounded memory, the counterpart of Reader:
+/// triangles are appended in batches and go out a block at a time. The
+/// bytes match ASCII::serialize / Binary::serialize of the same mesh,
+/// including normals computed for zero ones. Move-only.
+class Writer {
+public:
+    Writer(Writer&& other) noexcept;
+    Writer& operator=(Writer&& other) noexcept;
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+    ~Writer();
+
+    /// Start a solid called `name` (the 80-byte header for binary output).
+    /// Binary output needs the triangle count up front: pass `count`, or
+    /// use a seekable stream and the header is patched by finish().
+    /// `os` must outlive the writer.
+    [[nodiscard]] static std::expected<Writer, std::string>
+    open(std::ostream& os, Format format, std::string_view name,
+         std::optional<std::size_t> count = std::nullopt,
+         const SerializeOptions& options = {},
+         std::uint16_t attribute_byte_count = 0);
+
+    /// Create `path` for writing (the writer owns the file stream)
+    [[nodiscard]] static std::expected<Writer, std::string>
+    open(const std::filesystem::path& path, Format format, std::string_view name,
+         std::optional<std::size_t> count = std::nullopt,
+         const SerializeOptions& options = {},
+         std::uint16_t attribute_byte_count = 0);
+
+    /// Append triangles; errors are sticky
+    [[nodiscard]] std::expected<void, std::string> write(std::span<const Triangle> tris);
+
+    /// Write what is buffered and close the solid: 'endsolid' for ASCII, the
+    /// count check or patch for binary. Nothing more may be written.
+    [[nodiscard]] std::expected<void, std::string> finish();
+
+    [[nodiscard]] Format format() const noexcept;
+
+    /// Triangles accepted so far
+    [[nodiscard]] std::size_t written() const noexcept;
+
+private:
+    struct State;
+    explicit Writer(std::unique_ptr<State> state) noexcept;
+
+    std::unique_ptr<State> state_;
+};
+
+} // namespace Harmony::STL
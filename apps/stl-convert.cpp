@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// stl-convert: ASCII <-> binary STL conversion in constant memory.
+//
+//   stl-convert [--to ascii|binary] [--precision N] [--shortest] input output
+//
+// Without --to the output is the other format from the input.
+
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Convert.h"
+
+namespace {
+
+int usage() {
+    std::fputs("usage: stl-convert [--to ascii|binary] [--precision N] [--shortest] input output\n", stderr);
+    return 2;
+}
+
+// Format of the file at `path` from its first bytes and its size
+std::optional<Harmony::STL::Format> input_format(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return std::nullopt;
+    char head[Harmony::STL::Binary::prefix_size];
+    in.read(head, sizeof head);
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    return Harmony::STL::detect_format(std::string_view(head, static_cast<std::size_t>(in.gcount())),
+                                       ec ? std::nullopt : std::optional<std::size_t>(size));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using Harmony::STL::Format;
+
+    std::optional<Format> to;
+    Harmony::STL::SerializeOptions options;
+    std::string_view paths[2];
+    int npaths = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--to" && i + 1 < argc) {
+            const std::string_view f = argv[++i];
+            if (f == "ascii") to = Format::ascii;
+            else if (f == "binary") to = Format::binary;
+            else return usage();
+        } else if (arg == "--precision" && i + 1 < argc) {
+            const std::string_view n = argv[++i];
+            if (std::from_chars(n.data(), n.data() + n.size(), options.float_precision).ec != std::errc{})
+                return usage();
+        } else if (arg == "--shortest") {
+            options.shortest_round_trip = true;
+        } else if (npaths < 2 && !arg.starts_with("--")) {
+            paths[npaths++] = arg;
+        } else {
+            return usage();
+        }
+    }
+    if (npaths != 2) return usage();
+
+    const std::filesystem::path input(paths[0]), output(paths[1]);
+    if (!to) {
+        const auto from = input_format(input);
+        if (!from) {
+            std::fprintf(stderr, "stl-convert: cannot open '%s'\n", input.string().c_str());
+            return 1;
+        }
+        to = *from == Format::ascii ? Format::binary : Format::ascii;
+    }
+
+    const auto converted = Harmony::STL::convert(input, output, *to, options);
+    if (!converted) {
+        std::fprintf(stderr, "stl-convert: %s\n", converted.error().c_str());
+        return 1;
+    }
+    std::fprintf(stderr, "%zu triangles written to %s (%s)\n", *converted, output.string().c_str(),
+                 *to == Format::ascii ? "ascii" : "binary");
+    return 0;
+}
@@ -0,0 +1,240 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Throughput of the parse/serialize hot paths. Every case reports bytes/s
+// (of STL data read or written) and items/s (triangles). Arguments:
+//   faces, normals (1 = present in the input, 0 = all zero),
+//   compute (compute_missing_normals for the parsers).
+// Run e.g. `HarmonyBench --benchmark_filter=Binary` to select a subset;
+// the ASCII cases stop at 10M faces (about 2 GB of text).
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "Harmony/STL/Ascii.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Parse.h"
+
+namespace {
+
+using namespace Harmony::STL;
+
+// Deterministic pseudo-random geometry; normals valid or all zero
+Mesh make_mesh(std::size_t faces, bool normals) {
+    Mesh m;
+    m.name = "bench";
+    m.tris.resize(faces);
+    std::uint32_t seed = 12345;
+    auto next = [&seed] {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) * (200.0f / 16777216.0f) - 100.0f;
+    };
+    for (Triangle& t : m.tris) {
+        for (Vec3& v : t.v) v = Vec3{next(), next(), next()};
+        t.normal = normals ? face_normal(t) : Vec3{};
+    }
+    return m;
+}
+
+enum class Data { mesh, ascii, binary };
+
+// The most recent input is kept between calls: the framework runs each
+// case several times and rebuilding 50M faces would dominate
+struct Input {
+    bool valid = false;
+    Data data = Data::mesh;
+    std::size_t faces = 0;
+    bool normals = false;
+    Mesh mesh;
+    std::string bytes;
+};
+
+const Input& input(Data data, std::size_t faces, bool normals) {
+    static Input cached;
+    if (cached.valid && cached.data == data && cached.faces == faces && cached.normals == normals)
+        return cached;
+    cached = Input{true, data, faces, normals, make_mesh(faces, normals), {}};
+    if (data == Data::ascii) {
+        cached.bytes = ASCII::serialize(cached.mesh);
+    } else if (data == Data::binary) {
+        std::ostringstream os(std::ios::binary);
+        Binary::serialize(os, cached.mesh, cached.mesh.name);
+        cached.bytes = std::move(os).str();
+    }
+    if (data != Data::mesh) cached.mesh = Mesh{};
+    return cached;
+}
+
+// Output sink that only counts bytes, so stream serializers are measured
+// without growing a string
+struct NullBuf : std::streambuf {
+    std::size_t bytes = 0;
+    int_type overflow(int_type c) override {
+        ++bytes;
+        return c;
+    }
+    std::streamsize xsputn(const char*, std::streamsize n) override {
+        bytes += static_cast<std::size_t>(n);
+        return n;
+    }
+};
+
+void report(benchmark::State& state, std::size_t bytes, std::size_t faces) {
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * faces));
+}
+
+std::size_t faces_arg(const benchmark::State& state) { return static_cast<std::size_t>(state.range(0)); }
+bool normals_arg(const benchmark::State& state) { return state.range(1) != 0; }
+bool compute_arg(const benchmark::State& state) { return state.range(2) != 0; }
+
+// ---- parsing ----
+
+void BM_AsciiParse(benchmark::State& state) {
+    const Input& in = input(Data::ascii, faces_arg(state), normals_arg(state));
+    for (auto _ : state) {
+        auto mesh = ASCII::parse(std::string_view(in.bytes), compute_arg(state));
+        benchmark::DoNotOptimize(mesh);
+    }
+    report(state, in.bytes.size(), in.faces);
+}
+
+void BM_AsciiParseStream(benchmark::State& state) {
+    const Input& in = input(Data::ascii, faces_arg(state), normals_arg(state));
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::istringstream is(in.bytes);
+        state.ResumeTiming();
+        auto mesh = ASCII::parse(is, compute_arg(state));
+        benchmark::DoNotOptimize(mesh);
+    }
+    report(state, in.bytes.size(), in.faces);
+}
+
+void BM_BinaryParse(benchmark::State& state) {
+    const Input& in = input(Data::binary, faces_arg(state), normals_arg(state));
+    for (auto _ : state) {
+        auto mesh = Binary::parse(std::string_view(in.bytes), compute_arg(state));
+        benchmark::DoNotOptimize(mesh);
+    }
+    report(state, in.bytes.size(), in.faces);
+}
+
+void BM_BinaryParseStream(benchmark::State& state) {
+    const Input& in = input(Data::binary, faces_arg(state), normals_arg(state));
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::istringstream is(in.bytes, std::ios::binary);
+        state.ResumeTiming();
+        auto mesh = Binary::parse(is, compute_arg(state));
+        benchmark::DoNotOptimize(mesh);
+    }
+    report(state, in.bytes.size(), in.faces);
+}
+
+// Format detection plus the chosen parser; range(1) picks the format
+void BM_DetectParse(benchmark::State& state) {
+    const Input& in = input(state.range(1) ? Data::binary : Data::ascii, faces_arg(state), true);
+    for (auto _ : state) {
+        auto mesh = parse(std::string_view(in.bytes), compute_arg(state));
+        benchmark::DoNotOptimize(mesh);
+    }
+    report(state, in.bytes.size(), in.faces);
+}
+
+// ---- serialization ----
+
+void BM_AsciiSerialize(benchmark::State& state) {
+    const Input& in = input(Data::mesh, faces_arg(state), normals_arg(state));
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        std::string text = ASCII::serialize(in.mesh);
+        bytes = text.size();
+        benchmark::DoNotOptimize(text);
+    }
+    report(state, bytes, in.faces);
+}
+
+void BM_AsciiSerializeStream(benchmark::State& state) {
+    const Input& in = input(Data::mesh, faces_arg(state), normals_arg(state));
+    NullBuf sink;
+    std::ostream os(&sink);
+    for (auto _ : state) ASCII::serialize(os, in.mesh);
+    report(state, sink.bytes / static_cast<std::size_t>(state.iterations()), in.faces);
+}
+
+void BM_BinarySerialize(benchmark::State& state) {
+    const Input& in = input(Data::mesh, faces_arg(state), normals_arg(state));
+    for (auto _ : state) {
+        auto bytes = Binary::serialize(in.mesh, in.mesh.name);
+        benchmark::DoNotOptimize(bytes);
+    }
+    report(state, Binary::serialized_size(in.mesh), in.faces);
+}
+
+void BM_BinarySerializeStream(benchmark::State& state) {
+    const Input& in = input(Data::mesh, faces_arg(state), normals_arg(state));
+    NullBuf sink;
+    std::ostream os(&sink);
+    for (auto _ : state) Binary::serialize(os, in.mesh, in.mesh.name);
+    report(state, Binary::serialized_size(in.mesh), in.faces);
+}
+
+constexpr std::int64_t max_faces = 50'000'000;
+constexpr std::int64_t max_ascii_faces = 10'000'000;
+
+// faces x {normals present, absent} x {compute on, off}
+void parse_args(benchmark::internal::Benchmark* b, std::int64_t limit) {
+    b->ArgNames({"faces", "normals", "compute"});
+    for (std::int64_t faces : {std::int64_t{1'000}, std::int64_t{100'000}, std::int64_t{1'000'000},
+                               std::int64_t{10'000'000}, max_faces}) {
+        if (faces > limit) continue;
+        for (int normals : {1, 0})
+            for (int compute : {1, 0}) b->Args({faces, normals, compute});
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+void serialize_args(benchmark::internal::Benchmark* b, std::int64_t limit) {
+    b->ArgNames({"faces", "normals"});
+    for (std::int64_t faces : {std::int64_t{1'000}, std::int64_t{100'000}, std::int64_t{1'000'000},
+                               std::int64_t{10'000'000}, max_faces}) {
+        if (faces > limit) continue;
+        for (int normals : {1, 0}) b->Args({faces, normals});
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+void ascii_parse_args(benchmark::internal::Benchmark* b) { parse_args(b, max_ascii_faces); }
+void binary_parse_args(benchmark::internal::Benchmark* b) { parse_args(b, max_faces); }
+void ascii_serialize_args(benchmark::internal::Benchmark* b) { serialize_args(b, max_ascii_faces); }
+void binary_serialize_args(benchmark::internal::Benchmark* b) { serialize_args(b, max_faces); }
+
+void detect_args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"faces", "binary", "compute"});
+    for (std::int64_t faces : {std::int64_t{1'000}, std::int64_t{1'000'000}})
+        for (int binary : {0, 1}) b->Args({faces, binary, 1});
+    b->Unit(benchmark::kMillisecond);
+}
+
+} // namespace
+
+BENCHMARK(BM_AsciiParse)->Apply(ascii_parse_args);
+BENCHMARK(BM_AsciiParseStream)->Apply(ascii_parse_args);
+BENCHMARK(BM_BinaryParse)->Apply(binary_parse_args);
+BENCHMARK(BM_BinaryParseStream)->Apply(binary_parse_args);
+BENCHMARK(BM_DetectParse)->Apply(detect_args);
+BENCHMARK(BM_AsciiSerialize)->Apply(ascii_serialize_args);
+BENCHMARK(BM_AsciiSerializeStream)->Apply(ascii_serialize_args);
+BENCHMARK(BM_BinarySerialize)->Apply(binary_serialize_args);
+BENCHMARK(BM_BinarySerializeStream)->Apply(binary_serialize_args);
@@ -7,327 +7,740 @@
 // ----------------------------------------------------------------------
 
 #include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
 #include <format>
-#include <cctype>
 #include <istream>
 #include <ostream>
-#include <sstream>
-#include <ranges>
+
+#if defined(HARMONY_X86_KERNELS)
+    #include <emmintrin.h>
+#endif
 
 #include "Harmony/STL/Ascii.h"
+#include "Harmony/STL/Normals.h"
+#include "Harmony/STL/Reader.h"
+#include "AsciiFormat.h"
+#include "AsciiNumber.h"
+#include "AsciiScanner.h"
+#include "FinishFaces.h"
+#include "Instrument.h"
+#include "Parallel.h"
+#include "ParseConfigs.h"
 
 namespace Harmony::STL::ASCII {
 
+namespace detail {
+
 namespace {
 
-inline std::string to_lower(std::string s) {
-    std::ranges::transform(s, s.begin(), [](unsigned char c){ return static_cast<char>(std::tolower(c)); });
-    return s;
+// Keywords are lowercase letters, so OR-ing 0x20 folds exactly [A-Za-z]
+inline bool keyword_is(std::string_view tok, std::string_view kw) noexcept {
+    if (tok.size() != kw.size()) return false;
+    for (size_t i = 0; i < kw.size(); ++i)
+        if (static_cast<char>(tok[i] | 0x20) != kw[i]) return false;
+    return true;
 }
-inline std::string_view trim(std::string_view sv) {
-    auto not_space = [](unsigned char c){ return !std::isspace(c); };
-    while (!sv.empty() && !not_space(static_cast<unsigned char>(sv.front()))) sv.remove_prefix(1);
-    while (!sv.empty() && !not_space(static_cast<unsigned char>(sv.back())))  sv.remove_suffix(1);
+
+// Pointer-based cursor over one line
+struct Cursor {
+    const char* p;
+    const char* e;
+
+    void skip_ws() noexcept { while (p < e && is_space(*p)) ++p; }
+    bool done() noexcept { skip_ws(); return p == e; }
+    std::string_view token() noexcept {
+        skip_ws();
+        const char* b = p;
+        while (p < e && !is_space(*p)) ++p;
+        return {b, static_cast<size_t>(p - b)};
+    }
+};
+
+inline std::string_view trim(std::string_view sv) noexcept {
+    while (!sv.empty() && is_space(sv.front())) sv.remove_prefix(1);
+    while (!sv.empty() && is_space(sv.back()))  sv.remove_suffix(1);
     return sv;
 }
-inline bool starts_with_icase(std::string_view sv, std::string_view prefix) {
-    if (sv.size() < prefix.size()) return false;
-    for (size_t i=0;i<prefix.size();++i) {
-        if (std::tolower(static_cast<unsigned char>(sv[i])) !=
-            std::tolower(static_cast<unsigned char>(prefix[i]))) return false;
+
+// Rest of the line, tokens joined by single spaces
+inline void join_name(Cursor c, std::string& name) {
+    name.clear();
+    for (auto tok = c.token(); !tok.empty(); tok = c.token()) {
+        if (!name.empty()) name.push_back(' ');
+        name.append(tok);
     }
-    return true;
 }
-inline std::vector<std::string_view> split_ws(std::string_view sv) {
-    std::vector<std::string_view> out;
-    sv = trim(sv);
-    while (!sv.empty()) {
-        // skip leading space
-        size_t i = 0;
-        while (i<sv.size() && std::isspace(static_cast<unsigned char>(sv[i]))) ++i;
-        sv.remove_prefix(i);
-        if (sv.empty()) break;
-        // find end
-        size_t j = 0;
-        while (j<sv.size() && !std::isspace(static_cast<unsigned char>(sv[j]))) ++j;
-        out.emplace_back(sv.substr(0, j));
-        sv.remove_prefix(j);
+
+// Three whitespace separated floats parsed in place, through the SWAR fast
+// path when it applies and std::from_chars otherwise. Too few tokens wins
+// over a malformed one; tokens past the third are ignored.
+inline bool three_floats(Cursor& c, Vec3& out, std::string_view& bad, bool& short_line) noexcept {
+    float vals[3];
+    bad = {};
+    for (auto& v : vals) {
+        if (bad.empty()) {
+            // Fast path; the number has to be the whole token
+            c.skip_ws();
+            const char* q = parse_float_fast(c.p, c.e, v);
+            if (q && (q == c.e || is_space(*q))) { c.p = q; continue; }
+        }
+        const auto tok = c.token();
+        if (tok.empty()) { short_line = true; return false; }
+        if (!bad.empty()) continue;
+        STL::detail::count(&Stats::slow_floats);
+        const char* last = tok.data() + tok.size();
+        if (auto [ptr, ec] = std::from_chars(tok.data(), last, v); ec != std::errc{} || ptr != last) bad = tok;
     }
-    return out;
+    short_line = false;
+    if (!bad.empty()) return false;
+    out = Vec3{vals[0], vals[1], vals[2]};
+    return true;
 }
-template<class T>
-inline std::expected<T, std::string> from_chars_sv(std::string_view sv) {
-    T value{};
-    auto* first = sv.data();
-    auto* last  = sv.data() + sv.size();
-    if (auto [ptr, ec] = std::from_chars(first, last, value); ec == std::errc{} && ptr==last) {
-        return value;
+
+} // namespace
+
+Scanner::Result Scanner::fail(std::string message) {
+    error = std::move(message);
+    return Result::error;
+}
+
+Scanner::Result Scanner::line(std::string_view line, std::size_t line_no) {
+    Cursor c{line.data(), line.data() + line.size()};
+    const auto kw = c.token();
+    if (kw.empty()) return Result::more;
+
+    if (!in_solid_) {
+        // Expect: solid [name...]
+        if (!keyword_is(kw, "solid")) {
+            return fail(std::format("Line {}: expected 'solid'", line_no));
+        }
+        join_name(c, name);
+        has_name = true;
+        in_solid_ = true;
+        return Result::more;
+    }
+
+    auto read_vec = [&](Vec3& out) -> bool {
+        std::string_view bad;
+        bool short_line = false;
+        if (three_floats(c, out, bad, short_line)) return true;
+        if (short_line) fail(std::format("Line {}: Expected three floats", line_no));
+        else fail(std::format("Line {}: Failed to parse number: '{}'", line_no, bad));
+        return false;
+    };
+
+    switch (kw.size()) {
+    case 5:
+        // facet normal i j k
+        if (keyword_is(kw, "facet")) {
+            if (!keyword_is(c.token(), "normal") || phase_ != Phase::idle)
+                return fail(std::format("Line {}: 'facet' where not expected", line_no));
+            if (!read_vec(current_.normal)) return Result::error;
+            phase_ = Phase::have_facet;
+            return Result::more;
+        }
+        // outer loop
+        if (keyword_is(kw, "outer")) {
+            if (!keyword_is(c.token(), "loop"))
+                return fail(std::format("Line {}: unexpected content: '{}'", line_no, trim(line)));
+            if (phase_ != Phase::have_facet)
+                return fail(std::format("Line {}: 'outer loop' without facet", line_no));
+            phase_ = Phase::in_loop;
+            vertex_count_ = 0;
+            return Result::more;
+        }
+        // tolerate repeated "solid name" lines inside (rare but seen)
+        if (keyword_is(kw, "solid")) {
+            join_name(c, name);
+            has_name = true;
+            return Result::more;
+        }
+        break;
+
+    case 6:
+        // vertex x y z
+        if (keyword_is(kw, "vertex")) {
+            if (phase_ != Phase::in_loop && phase_ != Phase::have_v1 && phase_ != Phase::have_v2)
+                return fail(std::format("Line {}: 'vertex' outside of loop", line_no));
+            Vec3 v;
+            if (!read_vec(v)) return Result::error;
+            if (vertex_count_ == 0)      { current_.v[0] = v; phase_ = Phase::have_v1; }
+            else if (vertex_count_ == 1) { current_.v[1] = v; phase_ = Phase::have_v2; }
+            else if (vertex_count_ == 2) { current_.v[2] = v; /* keep Phase::have_v2 */ }
+            else {
+                return fail(std::format("Line {}: too many vertices in loop", line_no));
+            }
+            ++vertex_count_;
+            return Result::more;
+        }
+        break;
+
+    case 7:
+        if (keyword_is(kw, "endloop")) {
+            if (vertex_count_ != 3)
+                return fail(std::format("Line {}: 'endloop' before three vertices", line_no));
+            return Result::more;
+        }
+        break;
+
+    case 8:
+        if (keyword_is(kw, "endfacet")) {
+            if (vertex_count_ != 3 || phase_ != Phase::have_v2)
+                return fail(std::format("Line {}: 'endfacet' without complete triangle", line_no));
+            triangle = current_;
+            current_ = Triangle{};
+            phase_ = Phase::idle;
+            return Result::facet;
+        }
+        // endsolid [name...] (name optional/ignored)
+        if (keyword_is(kw, "endsolid")) {
+            in_solid_ = false;
+            return Result::end;
+        }
+        break;
+
+    default:
+        break;
     }
-    return std::unexpected(std::format("Failed to parse number: '{}'", sv));
+
+    // Unknown token
+    return fail(std::format("Line {}: unexpected content: '{}'", line_no, trim(line)));
 }
 
-inline std::expected<std::array<float,3>, std::string>
-parse_three_floats_tail(std::string_view line_after_keyword) {
-    auto toks = split_ws(line_after_keyword);
-    if (toks.size() < 3) return std::unexpected("Expected three floats");
-    auto fx = from_chars_sv<float>(toks[0]);
-    if (!fx) return std::unexpected(fx.error());
-    auto fy = from_chars_sv<float>(toks[1]);
-    if (!fy) return std::unexpected(fy.error());
-    auto fz = from_chars_sv<float>(toks[2]);
-    if (!fz) return std::unexpected(fz.error());
-    return std::array<float,3>{*fx, *fy, *fz};
+Scanner::Result Scanner::finish() {
+    if (in_solid_ && phase_ != Phase::idle)
+        return fail(std::string("Unexpected EOF: unterminated facet/loop"));
+    return Result::more;
 }
 
-inline std::string lower_sv(std::string_view sv) {
-    std::string s(sv);
-    std::ranges::transform(s, s.begin(), [](unsigned char c){ return char(std::tolower(c)); });
-    return s;
+} // namespace detail
+
+namespace {
+
+using STL::detail::PhaseTimer;
+using STL::detail::StatsScope;
+
+template <class A>
+inline void append(BasicMesh<A>& mesh, const Triangle& t) {
+    STL::detail::count_growth(mesh.tris);
+    mesh.tris.push_back(t);
+}
+inline void append(MeshSoA& mesh, const Triangle& t) { mesh.push_back(t); }
+template <class A>
+inline size_t finish(BasicMesh<A>& mesh, bool compute, GeometryStats* geometry) {
+    return STL::detail::finish_faces(std::span<Triangle>(mesh.tris), compute, geometry);
+}
+inline size_t finish(MeshSoA& mesh, bool compute, GeometryStats* geometry) {
+    return STL::detail::finish_faces(mesh, compute, geometry);
+}
+template <class A>
+inline size_t facets(const BasicMesh<A>& mesh) noexcept { return mesh.tris.size(); }
+inline size_t facets(const MeshSoA& mesh) noexcept { return mesh.size(); }
+inline void set_name(Mesh& mesh, std::string& name) { mesh.name = std::move(name); }
+inline void set_name(MeshSoA& mesh, std::string& name) { mesh.name = std::move(name); }
+inline void set_name(pmr::Mesh& mesh, std::string& name) { mesh.name.assign(name); }
+
+// Shortest well-formed facet ("facet normal 0 0 0", "outer loop", three
+// "vertex 0 0 0", "endloop", "endfacet") is 89 bytes; a facet count above
+// size / 64 cannot be real, so it never drives the reservation
+constexpr size_t min_facet_bytes = 64;
+
+// `f` points at an 'f'/'F'; true if it is the 'f' of a whole-word "endfacet"
+inline bool endfacet_at(const char* begin, const char* end, const char* f) noexcept {
+    if (f - begin < 3 || end - f < 5) return false;
+    const char* w = f - 3;
+    if (!detail::keyword_is(std::string_view(w, 8), "endfacet")) return false;
+    return (w == begin || detail::is_space(w[-1])) && (w + 8 == end || detail::is_space(w[8]));
+}
+
+inline size_t facet_capacity(std::string_view text) noexcept {
+    return std::min(count_facets(text), text.size() / min_facet_bytes + 1);
 }
 
-inline bool tok_is(std::string_view sv, std::string_view expect_lc) {
-    // compare case-insensitively without allocating for expect
-    if (sv.size() != expect_lc.size()) {
-        // allow different sizes with lower for sv then compare
-        return lower_sv(sv) == expect_lc;
+template <class A>
+inline void reserve(BasicMesh<A>& mesh, size_t n) { mesh.tris.reserve(n); }
+inline void reserve(MeshSoA& mesh, size_t n) { mesh.reserve(n); }
+
+template <class A>
+inline void clear(BasicMesh<A>& mesh) noexcept {
+    mesh.name.clear();
+    mesh.tris.clear();
+    mesh.attributes.clear();
+}
+inline void clear(MeshSoA& mesh) noexcept { mesh.name.clear(); mesh.clear(); }
+
+// Parse into `mesh`, which is cleared first but keeps its capacity
+template <class Out>
+std::expected<void, std::string>
+parse_into_impl(std::string_view text, bool compute_missing_normals, Out& mesh,
+                GeometryStats* geometry = nullptr) noexcept {
+    using detail::Scanner;
+    Scanner scanner;
+    clear(mesh);
+    if (geometry) *geometry = {};
+    // A vectorised pre-scan is far cheaper than regrowing the output
+    reserve(mesh, facet_capacity(text));
+
+    const char* p = text.data();
+    const char* const end = p + text.size();
+    {
+        const PhaseTimer timer(&Stats::scan);
+        size_t line_no = 1;
+        for (; p < end; ++line_no) {
+            const auto* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+            const char* line_end = nl ? nl : end;
+            const auto r = scanner.line(std::string_view(p, static_cast<size_t>(line_end - p)), line_no);
+            if (r == Scanner::Result::facet) append(mesh, scanner.triangle);
+            else if (r == Scanner::Result::end) break;
+            else if (r == Scanner::Result::error) return std::unexpected(std::move(scanner.error));
+            p = nl ? nl + 1 : end;
+        }
+        STL::detail::count(&Stats::lines, p < end ? line_no : line_no - 1);
+        STL::detail::count(&Stats::bytes_read, text.size());
     }
-    for (size_t i=0;i<sv.size();++i)
-        if (std::tolower((unsigned char)sv[i]) != expect_lc[i]) return false;
-    return true;
+    if (scanner.finish() == Scanner::Result::error) return std::unexpected(std::move(scanner.error));
+
+    set_name(mesh, scanner.name);
+    STL::detail::count(&Stats::facets, facets(mesh));
+    // Missing normals are recomputed (and the faces measured) in one batch
+    // once the facets are in
+    if (compute_missing_normals || geometry) {
+        const PhaseTimer timer(&Stats::normals);
+        STL::detail::count(&Stats::normals_computed, finish(mesh, compute_missing_normals, geometry));
+    }
+    return {};
 }
 
-// Parse three floats from tokens[t..t+2]
-inline std::expected<std::array<float,3>, std::string>
-parse_three_floats_tokens(const std::vector<std::string_view>& toks, size_t t, size_t line_no) {
-    if (toks.size() < t+3) return std::unexpected(std::format("Line {}: Expected three floats", line_no));
-    auto fx = from_chars_sv<float>(toks[t+0]); if (!fx) return std::unexpected(std::format("Line {}: {}", line_no, fx.error()));
-    auto fy = from_chars_sv<float>(toks[t+1]); if (!fy) return std::unexpected(std::format("Line {}: {}", line_no, fy.error()));
-    auto fz = from_chars_sv<float>(toks[t+2]); if (!fz) return std::unexpected(std::format("Line {}: {}", line_no, fz.error()));
-    return std::array<float,3>{*fx, *fy, *fz};
+// `mesh` arrives empty; it carries the allocator for Out
+template <class Out>
+std::expected<Out, std::string>
+parse_impl(std::string_view text, bool compute_missing_normals, Out mesh = Out{}) noexcept {
+    if (auto r = parse_into_impl(text, compute_missing_normals, mesh); !r)
+        return std::unexpected(std::move(r.error()));
+    return mesh;
 }
 
+// ---- chunked parallel parse ----
+
+constexpr size_t min_chunk_bytes = 256 * 1024;
+
+// Start of the first line after `from` whose first token is 'facet'; in a
+// well-formed file the serial parser is idle at every such line.
+const char* next_facet_line(const char* from, const char* end) noexcept {
+    const char* p = from;
+    while (p < end) {
+        const auto* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!nl) return end;
+        p = nl + 1;
+        const char* q = p;
+        while (q < end && *q != '\n' && detail::is_space(*q)) ++q;
+        if (end - q > 5 && detail::is_space(q[5]) && detail::keyword_is(std::string_view(q, 5), "facet"))
+            return p;
+    }
+    return end;
+}
 
-} // namespace
+struct Chunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    std::vector<Triangle> tris;
+    GeometryStats geometry;
+    std::string name;
+    bool has_name = false;
+    bool failed = false;    // any error, the serial parser reproduces it exactly
+    bool ended = false;     // reached 'endsolid'
+    bool resumable = true;  // idle inside a solid at the end of the chunk
+};
+
+void parse_chunk(Chunk& c, bool first, bool compute_missing_normals, bool measure) {
+    using detail::Scanner;
+    Scanner scanner;
+    if (!first) scanner.resume_in_solid();
+    c.tris.reserve(facet_capacity(std::string_view(c.begin, static_cast<size_t>(c.end - c.begin))));
+
+    for (const char* p = c.begin; p < c.end;) {
+        const auto* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(c.end - p)));
+        const char* line_end = nl ? nl : c.end;
+        // line numbers are fixed up by the serial re-parse should anything fail
+        const auto r = scanner.line(std::string_view(p, static_cast<size_t>(line_end - p)), 0);
+        if (r == Scanner::Result::facet) c.tris.push_back(scanner.triangle);
+        else if (r == Scanner::Result::end) { c.ended = true; break; }
+        else if (r == Scanner::Result::error) { c.failed = true; return; }
+        p = nl ? nl + 1 : c.end;
+    }
+    c.resumable = scanner.in_solid() && scanner.phase() == Scanner::Phase::idle;
+    c.name = std::move(scanner.name);
+    c.has_name = scanner.has_name;
+    STL::detail::finish_faces(c.tris, compute_missing_normals, measure ? &c.geometry : nullptr);
+}
 
-// In namespace Harmony::STL
-std::expected<Mesh, std::string>
-parse(std::string_view text, bool compute_missing_normals) noexcept {
-    Mesh mesh;
-    mesh.tris.clear();
+std::expected<void, std::string>
+parse_parallel(std::string_view text, bool compute_missing_normals, unsigned threads, Mesh& mesh,
+               GeometryStats* geometry) {
+    const char* const begin = text.data();
+    const char* const end = begin + text.size();
+
+    // Cut near equal byte offsets, snapped forward to facet lines
+    const size_t wanted = std::min<size_t>(size_t{threads} * 4, text.size() / min_chunk_bytes);
+    std::vector<Chunk> chunks;
+    const char* start = begin;
+    for (size_t k = 1; k < wanted; ++k) {
+        const char* cut = begin + text.size() / wanted * k;
+        if (cut <= start) continue;
+        cut = next_facet_line(cut, end);
+        if (cut >= end) break;
+        chunks.emplace_back().begin = start;
+        chunks.back().end = cut;
+        start = cut;
+    }
+    chunks.emplace_back().begin = start;
+    chunks.back().end = end;
+
+    {
+        const PhaseTimer timer(&Stats::scan);
+        STL::detail::parallel_for(chunks.size(), threads, [&](size_t i) {
+            parse_chunk(chunks[i], i == 0, compute_missing_normals, geometry != nullptr);
+        });
+    }
 
-    // State
-    bool in_solid = false;
-    Triangle current{};
-    enum class Phase { idle, have_facet, in_loop, have_v1, have_v2 } phase = Phase::idle;
-    size_t vertex_count = 0;   // vertices seen inside current outer loop
-    size_t line_no = 0;
-
-    // Helpers (local lambdas)
-    auto trim_sv = [](std::string_view sv) {
-        auto issp = [](unsigned char c){ return std::isspace(c); };
-        while (!sv.empty() && issp((unsigned char)sv.front())) sv.remove_prefix(1);
-        while (!sv.empty() && issp((unsigned char)sv.back()))  sv.remove_suffix(1);
-        return sv;
-    };
-    auto tokenize_ws = [&](std::string_view sv) {
-        std::vector<std::string_view> out;
-        sv = trim_sv(sv);
-        while (!sv.empty()) {
-            size_t i = 0; while (i < sv.size() && std::isspace((unsigned char)sv[i])) ++i;
-            sv.remove_prefix(i);
-            if (sv.empty()) break;
-            size_t j = 0; while (j < sv.size() && !std::isspace((unsigned char)sv[j])) ++j;
-            out.emplace_back(sv.substr(0, j));
-            sv.remove_prefix(j);
+    // Walk the chunks in file order exactly as the serial parser would
+    size_t used = chunks.size();
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        const Chunk& c = chunks[i];
+        if (c.failed) return parse_into_impl(text, compute_missing_normals, mesh, geometry);
+        if (c.ended) { used = i + 1; break; }
+        // a facet left open across a cut, an unterminated final facet, or no
+        // 'solid' at all: let the serial parser report it
+        if (!c.resumable) return parse_into_impl(text, compute_missing_normals, mesh, geometry);
+    }
+
+    clear(mesh);
+    if (geometry) *geometry = {};
+    std::vector<size_t> offset(used + 1, 0);
+    for (size_t i = 0; i < used; ++i) {
+        offset[i + 1] = offset[i] + chunks[i].tris.size();
+        if (chunks[i].has_name) mesh.name = std::move(chunks[i].name);
+        if (geometry) geometry->merge(chunks[i].geometry);
+    }
+    mesh.tris.resize(offset[used]);
+    STL::detail::parallel_for(used, threads, [&](size_t i) {
+        std::ranges::copy(chunks[i].tris, mesh.tris.begin() + static_cast<std::ptrdiff_t>(offset[i]));
+        std::vector<Triangle>().swap(chunks[i].tris);
+    });
+    STL::detail::count(&Stats::bytes_read, text.size());
+    STL::detail::count(&Stats::facets, mesh.tris.size());
+    return {};
+}
+
+// ---- compile-time configured parse ----
+
+// parse<Config{.validate = false}>: facets read by token position, with no
+// keyword or phase checks. Only the common layout is followed; anything
+// else (a bad number, EOF inside a facet, a token other than facet or
+// endsolid where a facet starts) returns false so that the caller runs
+// the checking parser, which accepts the input or reports the error.
+template <bool ReadNormals, class Out>
+bool parse_by_position(std::string_view text, Out& mesh) {
+    clear(mesh);
+    reserve(mesh, facet_capacity(text));
+    detail::Cursor c{text.data(), text.data() + text.size()};
+    if (!detail::keyword_is(c.token(), "solid")) return false;
+    const auto* nl = static_cast<const char*>(std::memchr(c.p, '\n', static_cast<size_t>(c.e - c.p)));
+    std::string name;
+    detail::join_name(detail::Cursor{c.p, nl ? nl : c.e}, name);
+    c.p = nl ? nl : c.e;
+
+    std::string_view bad;
+    bool short_line = false;
+    Triangle t{};
+    for (;;) {
+        const auto kw = c.token();
+        if (kw.empty()) return false;
+        if ((kw[0] | 0x20) == 'e') {
+            if (!detail::keyword_is(kw, "endsolid")) return false;
+            break;
         }
-        return out;
-    };
-    auto eq_ci = [](std::string_view a, std::string_view b_lc) {
-        // compare a (any case) to b in lowercase
-        if (a.size() != b_lc.size()) return false;
-        for (size_t i = 0; i < a.size(); ++i)
-            if (char(std::tolower((unsigned char)a[i])) != b_lc[i]) return false;
-        return true;
-    };
-    auto three_floats_from = [&](const std::vector<std::string_view>& toks, size_t start) -> std::expected<std::array<float,3>, std::string> {
-        if (toks.size() < start + 3) return std::unexpected(std::string("Expected three floats"));
-        auto readf = [](std::string_view sv) -> std::expected<float,std::string> {
-            float v{};
-            const char* f = sv.data();
-            const char* l = sv.data() + sv.size();
-            if (auto [p, ec] = std::from_chars(f, l, v); ec == std::errc{} && p == l) return v;
-            return std::unexpected(std::format("Failed to parse number: '{}'", sv));
-        };
-        auto fx = readf(toks[start+0]); if (!fx) return std::unexpected(fx.error());
-        auto fy = readf(toks[start+1]); if (!fy) return std::unexpected(fy.error());
-        auto fz = readf(toks[start+2]); if (!fz) return std::unexpected(fz.error());
-        return std::array<float,3>{*fx, *fy, *fz};
-    };
-    auto join_name = [](const std::vector<std::string_view>& toks, size_t start) {
-        std::string name;
-        for (size_t i = start; i < toks.size(); ++i) {
-            if (i > start) name.push_back(' ');
-            name.append(toks[i].begin(), toks[i].end());
+        if ((kw[0] | 0x20) != 'f') return false;
+        c.token(); // normal
+        if constexpr (ReadNormals) {
+            if (!detail::three_floats(c, t.normal, bad, short_line)) return false;
+        } else {
+            for (int k = 0; k < 3; ++k) c.token();
         }
-        return name;
-    };
+        c.token(); // outer
+        c.token(); // loop
+        for (Vec3& v : t.v) {
+            c.token(); // vertex
+            if (!detail::three_floats(c, v, bad, short_line)) return false;
+        }
+        c.token(); // endloop
+        c.token(); // endfacet
+        append(mesh, t);
+    }
+    set_name(mesh, name);
+    return true;
+}
 
-    for (auto line_view : text | std::views::split('\n')) {
-        ++line_no;
-        std::string_view line{ &*line_view.begin(), static_cast<size_t>(std::ranges::distance(line_view)) };
-        auto line_trim = trim_sv(line);
-        if (line_trim.empty()) continue;
+inline void recompute(Mesh& mesh) noexcept { recompute_normals(std::span<Triangle>(mesh.tris)); }
+inline void recompute(MeshSoA& mesh) noexcept { recompute_normals(mesh); }
 
-        auto toks = tokenize_ws(line_trim);
-        if (toks.empty()) continue;
+// ---- serialization ----
 
-        if (!in_solid) {
-            // Expect: solid [name...]
-            if (!eq_ci(toks[0], "solid")) {
-                return std::unexpected(std::format("Line {}: expected 'solid'", line_no));
-            }
-            mesh.name = (toks.size() > 1) ? join_name(toks, 1) : std::string{};
-            in_solid = true;
-            continue;
-        }
+using detail::TextFormat;
 
-        // endsolid [name...] (name optional/ignored)
-        if (eq_ci(toks[0], "endsolid")) {
-            in_solid = false;
-            break;
-        }
+constexpr size_t normal_block = 1024;       // triangles fixed up per batch when writing
+constexpr size_t flush_bytes = 1024 * 1024; // stream serializer write size
 
-        // facet normal i j k
-        if (eq_ci(toks[0], "facet")) {
-            if (toks.size() < 2 || !eq_ci(toks[1], "normal"))
-                return std::unexpected(std::format("Line {}: 'facet' where not expected", line_no));
-            if (phase != Phase::idle)
-                return std::unexpected(std::format("Line {}: 'facet' where not expected", line_no));
-            auto arr = three_floats_from(toks, 2);
-            if (!arr) return std::unexpected(std::format("Line {}: {}", line_no, arr.error()));
-            current.normal = Vec3{(*arr)[0], (*arr)[1], (*arr)[2]};
-            phase = Phase::have_facet;
-            continue;
-        }
+constexpr size_t parallel_slice_tris = 16 * 1024; // facets formatted per task
 
-        // outer loop
-        if (eq_ci(toks[0], "outer")) {
-            if (toks.size() < 2 || !eq_ci(toks[1], "loop"))
-                return std::unexpected(std::format("Line {}: unexpected content: '{}'", line_no, std::string(line_trim)));
-            if (phase != Phase::have_facet)
-                return std::unexpected(std::format("Line {}: 'outer loop' without facet", line_no));
-            phase = Phase::in_loop;
-            vertex_count = 0;
-            continue;
+/// Calls fn(span) for consecutive blocks of `tris`, with missing normals
+/// filled on a copy so the mesh itself is untouched
+template <class Fn>
+void for_each_block(std::span<const Triangle> tris, Fn&& fn) {
+    std::vector<Triangle> block(std::min(tris.size(), normal_block));
+    for (size_t first = 0; first < tris.size(); first += block.size()) {
+        const size_t n = std::min(block.size(), tris.size() - first);
+        std::copy_n(tris.begin() + static_cast<std::ptrdiff_t>(first), n, block.begin());
+        {
+            // If normal is zero, compute one to keep exporters/readers happy
+            const PhaseTimer timer(&Stats::normals);
+            STL::detail::count(&Stats::normals_computed, fill_missing_normals(std::span<Triangle>(block.data(), n)));
         }
+        fn(std::span<const Triangle>(block.data(), n));
+    }
+}
 
-        // vertex x y z
-        if (eq_ci(toks[0], "vertex")) {
-            if (phase != Phase::in_loop && phase != Phase::have_v1 && phase != Phase::have_v2)
-                return std::unexpected(std::format("Line {}: 'vertex' outside of loop", line_no));
-            auto arr = three_floats_from(toks, 1);
-            if (!arr) return std::unexpected(std::format("Line {}: {}", line_no, arr.error()));
-
-            if (vertex_count == 0)      { current.v[0] = Vec3{(*arr)[0], (*arr)[1], (*arr)[2]}; phase = Phase::have_v1; }
-            else if (vertex_count == 1) { current.v[1] = Vec3{(*arr)[0], (*arr)[1], (*arr)[2]}; phase = Phase::have_v2; }
-            else if (vertex_count == 2) { current.v[2] = Vec3{(*arr)[0], (*arr)[1], (*arr)[2]}; /* keep Phase::have_v2 */ }
-            else {
-                return std::unexpected(std::format("Line {}: too many vertices in loop", line_no));
-            }
-            ++vertex_count;
-            continue;
-        }
+size_t slice_count(size_t tris) noexcept {
+    return (tris + parallel_slice_tris - 1) / parallel_slice_tris;
+}
 
-        // endloop
-        if (eq_ci(toks[0], "endloop")) {
-            if (vertex_count != 3)
-                return std::unexpected(std::format("Line {}: 'endloop' before three vertices", line_no));
-            continue;
-        }
+std::span<const Triangle> slice(const Mesh& mesh, size_t i) noexcept {
+    const size_t first = i * parallel_slice_tris;
+    return std::span<const Triangle>(mesh.tris).subspan(first, std::min(parallel_slice_tris, mesh.tris.size() - first));
+}
 
-        // endfacet
-        if (eq_ci(toks[0], "endfacet")) {
-            if (vertex_count != 3 || phase != Phase::have_v2)
-                return std::unexpected(std::format("Line {}: 'endfacet' without complete triangle", line_no));
-            if (compute_missing_normals) {
-                if (std::abs(current.normal.x) + std::abs(current.normal.y) + std::abs(current.normal.z) < 1e-20f) {
-                    current.normal = face_normal(current);
-                }
-            }
-            mesh.tris.push_back(current);
-            current = Triangle{};
-            phase = Phase::idle;
-            continue;
-        }
+/// Append the facets of `tris` to `out`
+void format_slice(const TextFormat& format, std::span<const Triangle> tris, std::string& out) {
+    out.reserve(out.size() + tris.size() * 160);
+    for_each_block(tris, [&](std::span<const Triangle> block) {
+        const PhaseTimer timer(&Stats::encode);
+        format.facets(out, block);
+    });
+}
 
-        // tolerate repeated "solid name" lines inside (rare but seen)
-        if (eq_ci(toks[0], "solid")) {
-            mesh.name = (toks.size() > 1) ? join_name(toks, 1) : std::string{};
-            continue;
-        }
+} // namespace
 
-        // Unknown token
-        return std::unexpected(std::format("Line {}: unexpected content: '{}'", line_no, std::string(line_trim)));
+size_t count_facets(std::string_view text) noexcept {
+    const char* const begin = text.data();
+    const char* const end = begin + text.size();
+    const char* p = begin;
+    size_t count = 0;
+    // Candidates are the bytes that fold to 'f' (two per facet in practice)
+#if defined(HARMONY_X86_KERNELS)
+    const __m128i fold = _mm_set1_epi8(0x20);
+    const __m128i f = _mm_set1_epi8('f');
+    for (; end - p >= 16; p += 16) {
+        const __m128i x = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), fold);
+        auto m = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, f)));
+        for (; m; m &= m - 1) count += endfacet_at(begin, end, p + std::countr_zero(m)) ? 1 : 0;
     }
+#endif
+    for (; p < end; ++p)
+        if ((*p | 0x20) == 'f') count += endfacet_at(begin, end, p) ? 1 : 0;
+    return count;
+}
 
-    if (in_solid) {
-        if (phase != Phase::idle)
-            return std::unexpected(std::string("Unexpected EOF: unterminated facet/loop"));
+std::expected<void, std::string>
+parse_into(std::string_view text, Mesh& mesh, const ParseOptions& options) {
+    const StatsScope scope("ASCII::parse");
+    unsigned threads = STL::detail::resolve_threads(options.threads);
+    if (options.memory_limit != 0) {
+        const size_t n = facet_capacity(text);
+        const size_t need = n * sizeof(Triangle);
+        if (need > options.memory_limit) {
+            clear(mesh);
+            if (options.geometry) *options.geometry = {};
+            return std::unexpected(std::format("{} facets need {} bytes, over the {}-byte memory limit", n, need,
+                                               options.memory_limit));
+        }
+        if (need > options.memory_limit / 2) threads = 1;
+    }
+    auto r = threads <= 1 || text.size() < 2 * min_chunk_bytes
+        ? parse_into_impl(text, options.compute_missing_normals, mesh, options.geometry)
+        : parse_parallel(text, options.compute_missing_normals, threads, mesh, options.geometry);
+    if (!r) {
+        mesh.tris.clear();
+        mesh.attributes.clear();
+        if (options.geometry) *options.geometry = {};
     }
+    return r;
+}
+
+std::expected<Mesh, std::string>
+parse(std::string_view text, const ParseOptions& options) {
+    Mesh mesh;
+    if (auto r = parse_into(text, mesh, options); !r) return std::unexpected(std::move(r.error()));
     return mesh;
 }
 
-std::expected<Mesh, std::string> parse(std::istream& is, bool compute_missing_normals) {
-    std::ostringstream oss;
-    oss << is.rdbuf();
-    if (!is.good() && !is.eof()) {
-        return std::unexpected("I/O error while reading stream");
+// In namespace Harmony::STL
+std::expected<Mesh, std::string>
+parse(std::string_view text, bool compute_missing_normals) noexcept {
+    const StatsScope scope("ASCII::parse");
+    return parse_impl<Mesh>(text, compute_missing_normals);
+}
+
+std::expected<pmr::Mesh, std::string>
+parse(std::string_view text, std::pmr::memory_resource* resource, bool compute_missing_normals) noexcept {
+    const StatsScope scope("ASCII::parse");
+    return parse_impl(text, compute_missing_normals, pmr::Mesh(resource));
+}
+
+std::expected<MeshSoA, std::string>
+parse_soa(std::string_view text, bool compute_missing_normals) noexcept {
+    const StatsScope scope("ASCII::parse_soa");
+    return parse_impl<MeshSoA>(text, compute_missing_normals);
+}
+
+template <ParseConfig Config>
+std::expected<ParsedMesh<Config>, std::string> parse(std::string_view text) {
+    const StatsScope scope("ASCII::parse");
+    ParsedMesh<Config> mesh;
+    bool parsed = false;
+    if constexpr (!Config.validate) {
+        const PhaseTimer timer(&Stats::scan);
+        parsed = parse_by_position<Config.normals != NormalPolicy::recompute>(text, mesh);
+        if (parsed) {
+            STL::detail::count(&Stats::bytes_read, text.size());
+            STL::detail::count(&Stats::facets, facets(mesh));
+        }
+    }
+    if (!parsed)
+        if (auto r = parse_into_impl(text, false, mesh); !r) return std::unexpected(std::move(r.error()));
+
+    if constexpr (Config.normals == NormalPolicy::fill_missing) {
+        const PhaseTimer timer(&Stats::normals);
+        STL::detail::count(&Stats::normals_computed, finish(mesh, true, nullptr));
+    } else if constexpr (Config.normals == NormalPolicy::recompute) {
+        const PhaseTimer timer(&Stats::normals);
+        recompute(mesh);
+        STL::detail::count(&Stats::normals_computed, facets(mesh));
     }
-    return parse(oss.str(), compute_missing_normals);
+    return mesh;
+}
+
+#define HARMONY_INSTANTIATE(Config) \
+    template std::expected<ParsedMesh<Config>, std::string> parse<Config>(std::string_view);
+HARMONY_FOR_EACH_PARSE_CONFIG(HARMONY_INSTANTIATE)
+#undef HARMONY_INSTANTIATE
+
+std::expected<Mesh, std::string> parse(std::istream& is, bool compute_missing_normals) {
+    const StatsScope scope("ASCII::parse");
+    // Streamed through the batch reader: the text is never held in memory whole
+    auto reader = Reader::open(is, Format::ascii, compute_missing_normals);
+    if (!reader) return std::unexpected(std::move(reader.error()));
+    reader->limit_line_length(0); // the mesh is held whole anyway
+    return read_mesh(*reader);
 }
 
 std::string serialize(const Mesh& mesh, int float_precision) {
+    SerializeOptions options;
+    options.float_precision = float_precision;
+    return serialize(mesh, options);
+}
+
+std::string serialize(const Mesh& mesh, const SerializeOptions& options) {
+    const StatsScope scope("ASCII::serialize");
+    STL::detail::count(&Stats::facets, mesh.tris.size());
+    const TextFormat format(options);
+    const unsigned threads = STL::detail::resolve_threads(options.threads);
     std::string out;
-    out.reserve(std::max<size_t>(128, mesh.tris.size() * 160));
-    out += "solid ";
-    out += mesh.name;
-    out += '\n';
-    const auto fmt = std::format("{{:.{}f}}", float_precision);
-
-    auto fmt3 = [&](const Vec3& v){
-        return std::format("{} {} {}",
-            std::vformat(fmt, std::make_format_args(v.x)),
-            std::vformat(fmt, std::make_format_args(v.y)),
-            std::vformat(fmt, std::make_format_args(v.z))
-        );
-    };
+    if (threads <= 1 || mesh.tris.size() < 2 * parallel_slice_tris) {
+        out.reserve(std::max<size_t>(128, mesh.tris.size() * 160));
+        format.begin_solid(out, mesh.name);
+        format_slice(format, mesh.tris, out);
+        format.end_solid(out, mesh.name);
+        STL::detail::count(&Stats::bytes_written, out.size());
+        return out;
+    }
 
-    for (const auto& t : mesh.tris) {
-        Vec3 n = t.normal;
-        // If normal is zero, compute one to keep exporters/readers happy
-        if (std::abs(n.x)+std::abs(n.y)+std::abs(n.z) < 1e-20f) {
-            n = face_normal(t);
-        }
-        out += "  facet normal ";
-        out += fmt3(n);
-        out += '\n';
-        out += "    outer loop\n";
-        out += "      vertex " + fmt3(t.v[0]) + '\n';
-        out += "      vertex " + fmt3(t.v[1]) + '\n';
-        out += "      vertex " + fmt3(t.v[2]) + '\n';
-        out += "    endloop\n";
-        out += "  endfacet\n";
+    // Each slice is formatted into its own buffer, then joined in order:
+    // the text is byte-identical to the serial result
+    std::vector<std::string> parts(slice_count(mesh.tris.size()));
+    {
+        const PhaseTimer timer(&Stats::encode);
+        STL::detail::parallel_for(parts.size(), threads, [&](size_t i) {
+            format_slice(format, slice(mesh, i), parts[i]);
+        });
     }
-    out += "endsolid ";
-    out += mesh.name;
-    out += '\n';
+    size_t total = 2 * mesh.name.size() + 16;
+    for (const auto& part : parts) total += part.size();
+    out.reserve(total);
+    format.begin_solid(out, mesh.name);
+    for (auto& part : parts) {
+        out += part;
+        std::string().swap(part);
+    }
+    format.end_solid(out, mesh.name);
+    STL::detail::count(&Stats::bytes_written, out.size());
     return out;
 }
 
 bool serialize(std::ostream& os, const Mesh& mesh, int float_precision) {
-    auto s = serialize(mesh, float_precision);
-    os.write(s.data(), static_cast<std::streamsize>(s.size()));
-    return static_cast<bool>(os);
+    SerializeOptions options;
+    options.float_precision = float_precision;
+    return serialize(os, mesh, options);
+}
+
+bool serialize(std::ostream& os, const Mesh& mesh, const SerializeOptions& options) {
+    const StatsScope scope("ASCII::serialize");
+    STL::detail::count(&Stats::facets, mesh.tris.size());
+    const TextFormat format(options);
+    const unsigned threads = STL::detail::resolve_threads(options.threads);
+    std::string out;
+    auto flush = [&](std::string& buf) {
+        const PhaseTimer timer(&Stats::io);
+        STL::detail::count(&Stats::bytes_written, buf.size());
+        os.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+        buf.clear();
+        return static_cast<bool>(os);
+    };
+    format.begin_solid(out, mesh.name);
+
+    if (threads <= 1 || mesh.tris.size() < 2 * parallel_slice_tris) {
+        out.reserve(flush_bytes + normal_block * format.facet_bound());
+        bool ok = true;
+        for_each_block(mesh.tris, [&](std::span<const Triangle> block) {
+            if (!ok) return;
+            {
+                const PhaseTimer timer(&Stats::encode);
+                format.facets(out, block);
+            }
+            if (out.size() >= flush_bytes) ok = flush(out);
+        });
+        if (!ok) return false;
+    } else {
+        // Rounds of a few slices per thread, formatted in parallel and
+        // written in order; the buffers are reused between rounds
+        if (!flush(out)) return false;
+        const size_t slices = slice_count(mesh.tris.size());
+        std::vector<std::string> parts(std::min<size_t>(slices, size_t{threads} * 2));
+        for (size_t first = 0; first < slices; first += parts.size()) {
+            const size_t n = std::min(parts.size(), slices - first);
+            {
+                const PhaseTimer timer(&Stats::encode);
+                STL::detail::parallel_for(n, threads, [&](size_t i) {
+                    format_slice(format, slice(mesh, first + i), parts[i]);
+                });
+            }
+            for (size_t i = 0; i < n; ++i)
+                if (!flush(parts[i])) return false;
+        }
+    }
+    format.end_solid(out, mesh.name);
+    return flush(out);
 }
 
 } // namespace STL
@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Internal: facet text formatting shared by ASCII::serialize and the
+// streaming Writer, so both produce the same bytes.
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Harmony/STL/Mesh.h"
+#include "Harmony/STL/Options.h"
+
+namespace Harmony::STL::ASCII::detail {
+
+/// Facet text written with std::to_chars straight into the output string;
+/// fixed notation gives the same digits as std::format("{:.Nf}")
+class TextFormat {
+public:
+    explicit TextFormat(const SerializeOptions& options) noexcept
+        : precision_(std::max(0, options.float_precision)), shortest_(options.shortest_round_trip) {}
+
+    /// Upper bound on the bytes of one facet
+    [[nodiscard]] std::size_t facet_bound() const noexcept {
+        // "-" + 39 integer digits (FLT_MAX) + "." + precision, plus a separator
+        const std::size_t per_float = 42 + static_cast<std::size_t>(precision_);
+        return 128 + 12 * per_float;
+    }
+
+    void begin_solid(std::string& out, std::string_view name) const {
+        out += "solid ";
+        out += name;
+        out += '\n';
+    }
+
+    void end_solid(std::string& out, std::string_view name) const {
+        out += "endsolid ";
+        out += name;
+        out += '\n';
+    }
+
+    void facets(std::string& out, std::span<const Triangle> tris) const {
+        const std::size_t old = out.size();
+        out.resize_and_overwrite(old + tris.size() * facet_bound(), [&](char* buf, std::size_t) {
+            char* p = buf + old;
+            for (const Triangle& t : tris) {
+                p = literal(p, "  facet normal ");
+                p = vec3(p, t.normal);
+                p = literal(p, "\n    outer loop\n");
+                for (const Vec3& v : t.v) {
+                    p = literal(p, "      vertex ");
+                    p = vec3(p, v);
+                    *p++ = '\n';
+                }
+                p = literal(p, "    endloop\n  endfacet\n");
+            }
+            return static_cast<std::size_t>(p - buf);
+        });
+    }
+
+private:
+    template <std::size_t N>
+    static char* literal(char* p, const char (&s)[N]) noexcept {
+        std::memcpy(p, s, N - 1);
+        return p + N - 1;
+    }
+
+    char* number(char* p, float f) const noexcept {
+        // facet_bound() reserves enough room for any float at this precision
+        char* const limit = p + 42 + precision_;
+        return shortest_ ? std::to_chars(p, limit, f).ptr
+                         : std::to_chars(p, limit, f, std::chars_format::fixed, precision_).ptr;
+    }
+
+    char* vec3(char* p, const Vec3& v) const noexcept {
+        p = number(p, v.x);
+        *p++ = ' ';
+        p = number(p, v.y);
+        *p++ = ' ';
+        return number(p, v.z);
+    }
+
+    int precision_;
+    bool shortest_;
+};
+
+} // namespace Harmony::STL::ASCII::detail
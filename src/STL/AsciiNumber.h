@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Internal: fast path for the decimal floats on 'vertex' and 'facet normal'
+// lines. Digit runs of up to eight are consumed at once with SWAR arithmetic
+// on a 64-bit word (the fast_float technique); the value is then formed with a
+// single correctly rounded double operation (Clinger's fast path) and
+// narrowed to float. Whatever cannot be proven bit-identical to
+// std::from_chars<float> is rejected so the caller falls back to it.
+
+#pragma once
+
+#include <bit>
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace Harmony::STL::ASCII::detail {
+
+// The fast path relies on double operations rounding once, in IEEE binary64
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD == 0
+inline constexpr bool exact_double_ops = std::numeric_limits<double>::is_iec559;
+#else
+inline constexpr bool exact_double_ops = false;
+#endif
+
+inline std::uint64_t load_u64(const char* p) noexcept {
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof v);
+    if constexpr (std::endian::native == std::endian::big) v = std::byteswap(v);
+    return v;
+}
+
+/// Number of leading ASCII digits in the word (0..8). Bytes past the
+/// first non-digit may be garbled by carries, which only run upwards.
+inline int digit_run(std::uint64_t v) noexcept {
+    const std::uint64_t nondigit =
+        ((v + 0x4646464646464646ull) | (v - 0x3030303030303030ull)) & 0x8080808080808080ull;
+    return std::countr_zero(nondigit) >> 3;
+}
+
+/// Value of eight ASCII digits, first digit in the lowest byte
+inline std::uint32_t parse_eight_digits(std::uint64_t v) noexcept {
+    constexpr std::uint64_t mask = 0x000000FF000000FFull;
+    constexpr std::uint64_t mul1 = 100 + (1000000ull << 32);
+    constexpr std::uint64_t mul2 = 1 + (10000ull << 32);
+    v -= 0x3030303030303030ull;
+    v = (v * 10) + (v >> 8);
+    v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    return static_cast<std::uint32_t>(v);
+}
+
+/// Value of the first n (1..8) digits of the word: they are moved to the
+/// top and the bytes below are padded with '0'
+inline std::uint32_t parse_digits(std::uint64_t v, int n) noexcept {
+    if (n < 8) v = (v << (8 * (8 - n))) | (0x3030303030303030ull >> (8 * n));
+    return parse_eight_digits(v);
+}
+
+/// Append a run of digits to w, eight bytes at a time while the buffer allows
+inline const char* take_digits(const char* p, const char* e, std::uint64_t& w) noexcept {
+    constexpr std::uint64_t scale[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+    while (e - p >= 8) {
+        const std::uint64_t v = load_u64(p);
+        const int n = digit_run(v);
+        if (n == 0) return p;
+        w = w * scale[n] + parse_digits(v, n);
+        p += n;
+        if (n < 8) return p;
+    }
+    while (p < e && static_cast<unsigned>(*p - '0') < 10)
+        w = w * 10 + static_cast<unsigned>(*p++ - '0');
+    return p;
+}
+
+/// Parse [-]digits[.digits][(e|E)[+|-]digits] starting at `p`. On success
+/// stores the float and returns the end of the number; returns nullptr when
+/// the text is anything else or the fast path cannot guarantee the result
+/// std::from_chars would give.
+inline const char* parse_float_fast(const char* p, const char* e, float& out) noexcept {
+    if constexpr (!exact_double_ops) {
+        return nullptr;
+    } else {
+        const bool negative = p < e && *p == '-';
+        if (negative) ++p;
+
+        // Digits accumulate in w regardless of overflow; the count check
+        // below rejects anything with more than 19 significant digits
+        const char* const first = p;
+        std::uint64_t w = 0;
+        p = take_digits(p, e, w);
+        std::ptrdiff_t digits = p - first;
+        int exponent = 0;
+        if (p < e && *p == '.') {
+            const char* const frac = ++p;
+            p = take_digits(p, e, w);
+            exponent = -static_cast<int>(p - frac);
+            digits += p - frac;
+        }
+        if (digits == 0) return nullptr;
+        if (digits > 19) {
+            // leading zeros (either side of the point) do not count
+            for (const char* q = first; q < p && (*q == '0' || *q == '.'); ++q)
+                if (*q == '0') --digits;
+            if (digits > 19) return nullptr;
+        }
+
+        if (p < e && (*p | 0x20) == 'e') {
+            const char* q = p + 1;
+            const bool neg_exp = q < e && *q == '-';
+            if (q < e && (*q == '-' || *q == '+')) ++q;
+            int x = 0, n = 0;
+            for (; q < e && static_cast<unsigned>(*q - '0') < 10; ++q, ++n) {
+                if (n == 4) return nullptr;
+                x = x * 10 + (*q - '0');
+            }
+            if (n == 0) return nullptr; // from_chars would stop before the 'e'
+            exponent += neg_exp ? -x : x;
+            p = q;
+        }
+
+        if (w == 0) {
+            out = negative ? -0.0f : 0.0f;
+            return p;
+        }
+        // Clinger: w and 10^|exponent| are exact doubles, one rounding
+        constexpr double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+        if (w > (std::uint64_t{1} << 53) || exponent < -22 || exponent > 22) return nullptr;
+        const double d = exponent < 0 ? static_cast<double>(w) / pow10[-exponent]
+                                      : static_cast<double>(w) * pow10[exponent];
+        // Narrowing a correctly rounded double is only wrong when it sits
+        // exactly on a float rounding boundary (the 29 dropped bits are
+        // 1000...0); the range here excludes float subnormals and overflow
+        if ((std::bit_cast<std::uint64_t>(d) & ((std::uint64_t{1} << 29) - 1)) == (std::uint64_t{1} << 28))
+            return nullptr;
+        const float f = static_cast<float>(d);
+        out = negative ? -f : f;
+        return p;
+    }
+}
+
+} // namespace Harmony::STL::ASCII::detail
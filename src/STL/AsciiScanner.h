@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Internal: the line-level state machine behind ASCII::parse. It is fed one
+// line at a time (without the '\n'), so the whole-buffer parser, the
+// chunked parallel parser and the streaming reader share one grammar.
+// No heap allocation happens per facet; only a 'solid' name or an error
+// message allocates.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "Harmony/STL/Mesh.h"
+
+namespace Harmony::STL::ASCII::detail {
+
+class Scanner {
+public:
+    enum class Phase { idle, have_facet, in_loop, have_v1, have_v2 };
+    enum class Result {
+        more,     ///< line consumed, nothing to report
+        facet,    ///< `triangle` holds a completed facet
+        end,      ///< 'endsolid' reached; the remaining input is ignored
+        error     ///< `error` holds the message
+    };
+
+    /// Start in the middle of a solid (used by the chunked parser)
+    void resume_in_solid() noexcept { in_solid_ = true; }
+
+    /// Consume one line; `line_no` is only used for error messages
+    Result line(std::string_view line, std::size_t line_no);
+
+    /// End of input: fails if a facet or loop is still open
+    Result finish();
+
+    [[nodiscard]] Phase phase() const noexcept { return phase_; }
+    [[nodiscard]] bool in_solid() const noexcept { return in_solid_; }
+
+    Triangle triangle{};
+    std::string name;        ///< from the most recent 'solid' line
+    bool has_name = false;   ///< a 'solid' line was seen
+    std::string error;
+
+private:
+    Result fail(std::string message);
+
+    bool in_solid_ = false;
+    Phase phase_ = Phase::idle;
+    std::size_t vertex_count_ = 0; // vertices seen inside current outer loop
+    Triangle current_{};
+};
+
+/// Whitespace as std::isspace in the "C" locale ('\n' terminates lines)
+[[nodiscard]] constexpr bool is_space(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f' || c == '\n';
+}
+
+} // namespace Harmony::STL::ASCII::detail
@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "Harmony/STL/AsyncLoader.h"
+#include "Harmony/STL/Parse.h"
+#include "Parallel.h"
+
+namespace Harmony::STL {
+
+namespace {
+
+// Read a whole file; the I/O happens here rather than as page faults
+// during the parse, which is what lets it overlap with other parses
+std::expected<std::string, std::string> read_file(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return std::unexpected(std::format("STL: Cannot open '{}'", path.string()));
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    std::string bytes;
+    if (!ec) {
+        bytes.resize(static_cast<std::size_t>(size));
+        file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        bytes.resize(static_cast<std::size_t>(file.gcount()));
+    }
+    // Unknown size, or the file grew: read whatever is left
+    for (char block[64 * 1024]; file.read(block, sizeof block) || file.gcount() > 0;)
+        bytes.append(block, static_cast<std::size_t>(file.gcount()));
+    if (file.bad()) return std::unexpected(std::format("STL: I/O error while reading '{}'", path.string()));
+    return bytes;
+}
+
+} // namespace
+
+struct AsyncLoader::State {
+    struct Request {
+        std::filesystem::path path;
+        std::promise<LoadResult> promise;
+    };
+    struct Job {
+        std::string bytes;
+        std::promise<LoadResult> promise;
+    };
+
+    Config config;
+
+    mutable std::mutex mutex;
+    std::condition_variable read_cv;  // requests queued or stopping
+    std::condition_variable parse_cv; // jobs queued or readers gone
+    std::condition_variable space_cv; // buffered bytes went down
+    std::deque<Request> requests;
+    std::deque<Job> jobs;
+    std::size_t buffered = 0;
+    unsigned readers = 0; // I/O threads still running
+    bool stopping = false;
+
+    std::vector<std::jthread> threads;
+
+    void read_loop() {
+        std::unique_lock lock(mutex);
+        for (;;) {
+            read_cv.wait(lock, [&] { return stopping || !requests.empty(); });
+            if (requests.empty()) break;
+            Request request = std::move(requests.front());
+            requests.pop_front();
+            // Always allow one file through, however large
+            space_cv.wait(lock, [&] { return buffered == 0 || buffered < config.max_buffered_bytes; });
+
+            lock.unlock();
+            std::expected<std::string, std::string> bytes;
+            try {
+                bytes = read_file(request.path);
+            } catch (...) {
+                request.promise.set_exception(std::current_exception());
+                lock.lock();
+                continue;
+            }
+            lock.lock();
+
+            if (!bytes) {
+                request.promise.set_value(std::unexpected(std::move(bytes.error())));
+                continue;
+            }
+            buffered += bytes->size();
+            jobs.push_back(Job{std::move(*bytes), std::move(request.promise)});
+            parse_cv.notify_one();
+        }
+        if (--readers == 0) parse_cv.notify_all();
+    }
+
+    void parse_loop() {
+        std::unique_lock lock(mutex);
+        for (;;) {
+            parse_cv.wait(lock, [&] { return !jobs.empty() || readers == 0; });
+            if (jobs.empty()) break;
+            Job job = std::move(jobs.front());
+            jobs.pop_front();
+
+            lock.unlock();
+            std::optional<LoadResult> result;
+            std::exception_ptr failure;
+            try {
+                result.emplace(parse(std::string_view(job.bytes), config.options));
+            } catch (...) {
+                failure = std::current_exception();
+            }
+            const std::size_t size = job.bytes.size();
+            job.bytes = {};
+            lock.lock();
+
+            // Accounted before the result is published
+            buffered -= size;
+            space_cv.notify_all();
+            lock.unlock();
+            if (result) job.promise.set_value(std::move(*result));
+            else job.promise.set_exception(failure);
+            lock.lock();
+        }
+    }
+};
+
+AsyncLoader::AsyncLoader() : AsyncLoader(Config{}) {}
+
+AsyncLoader::AsyncLoader(const Config& config) : state_(std::make_unique<State>()) {
+    State& s = *state_;
+    s.config = config;
+    // Files parse concurrently; one GeometryStats cannot take them all
+    s.config.options.geometry = nullptr;
+    const unsigned io = std::max(1u, config.io_threads);
+    const unsigned workers = STL::detail::resolve_threads(config.parse_threads);
+    s.readers = io;
+    s.threads.reserve(io + workers);
+    for (unsigned i = 0; i < io; ++i) s.threads.emplace_back([&s] { s.read_loop(); });
+    for (unsigned i = 0; i < workers; ++i) s.threads.emplace_back([&s] { s.parse_loop(); });
+}
+
+AsyncLoader::~AsyncLoader() {
+    {
+        std::lock_guard lock(state_->mutex);
+        state_->stopping = true;
+    }
+    state_->read_cv.notify_all();
+    state_->threads.clear(); // joins: readers drain the requests, workers the jobs
+}
+
+std::future<LoadResult> AsyncLoader::load_async(const std::filesystem::path& path) {
+    State& s = *state_;
+    std::promise<LoadResult> promise;
+    auto future = promise.get_future();
+    {
+        std::lock_guard lock(s.mutex);
+        s.requests.push_back(State::Request{path, std::move(promise)});
+    }
+    s.read_cv.notify_one();
+    return future;
+}
+
+std::size_t AsyncLoader::buffered_bytes() const noexcept {
+    std::lock_guard lock(state_->mutex);
+    return state_->buffered;
+}
+
+std::future<LoadResult> load_async(const std::filesystem::path& path, const ParseOptions& options) {
+    return std::async(std::launch::async, [path, options] { return load(path, options); });
+}
+
+} // namespace Harmony::STL
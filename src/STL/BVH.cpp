@@ -0,0 +1,716 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "Harmony/STL/BVH.h"
+#include "Harmony/STL/Binary.h"
+#include "Parallel.h"
+
+namespace Harmony::STL {
+
+namespace {
+
+// Deeper than this the SAH is abandoned for object-median splits, which
+// bound the depth (and so the traversal stack) whatever the input
+constexpr int median_depth = 48;
+// Inner nodes on any root-to-leaf path: the median splits halve a 32-bit
+// count at most 32 times. decode() rejects deeper trees.
+constexpr std::size_t max_depth = median_depth + 32;
+// Each inner node on the path leaves at most three siblings pushed
+constexpr std::size_t stack_size = 3 * max_depth + 1;
+constexpr std::size_t max_bins = 64;
+constexpr std::size_t parallel_min_items = std::size_t{1} << 16;
+constexpr float traversal_cost = 1.0f; // relative to one triangle test
+
+// NaN-ignoring: a NaN `a` keeps `b`
+inline float lo_of(float a, float b) noexcept { return a < b ? a : b; }
+inline float hi_of(float a, float b) noexcept { return a > b ? a : b; }
+
+inline void grow(Box& b, const Vec3& p) noexcept {
+    b.min = Vec3{lo_of(p.x, b.min.x), lo_of(p.y, b.min.y), lo_of(p.z, b.min.z)};
+    b.max = Vec3{hi_of(p.x, b.max.x), hi_of(p.y, b.max.y), hi_of(p.z, b.max.z)};
+}
+
+inline void grow(Box& b, const Box& o) noexcept {
+    grow(b, o.min);
+    grow(b, o.max);
+}
+
+inline float component(const Vec3& v, int axis) noexcept {
+    return axis == 0 ? v.x : axis == 1 ? v.y : v.z;
+}
+
+inline float half_area(const Box& b) noexcept {
+    const float dx = b.max.x - b.min.x, dy = b.max.y - b.min.y, dz = b.max.z - b.min.z;
+    if (!(dx >= 0.0f && dy >= 0.0f && dz >= 0.0f)) return 0.0f;
+    return dx * dy + dy * dz + dz * dx;
+}
+
+inline Vec3 operator+(const Vec3& a, const Vec3& b) noexcept { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+inline Vec3 operator-(const Vec3& a, const Vec3& b) noexcept { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline Vec3 operator*(const Vec3& a, float s) noexcept { return {a.x * s, a.y * s, a.z * s}; }
+inline float dot(const Vec3& a, const Vec3& b) noexcept { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline Vec3 cross(const Vec3& a, const Vec3& b) noexcept {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+inline bool overlaps(const Box& a, const Box& b) noexcept {
+    return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y
+        && a.min.z <= b.max.z && b.min.z <= a.max.z;
+}
+
+Box tri_box(const BVH::Tri& t) noexcept {
+    Box b;
+    grow(b, t.v0);
+    grow(b, t.v0 + t.e1);
+    grow(b, t.v0 + t.e2);
+    return b;
+}
+
+Box slot_box(const BVH::Node& n, std::size_t k) noexcept {
+    return Box{Vec3{n.min_x[k], n.min_y[k], n.min_z[k]}, Vec3{n.max_x[k], n.max_y[k], n.max_z[k]}};
+}
+
+// Möller-Trumbore; t in (tmin, tmax)
+inline bool hit_tri(const BVH::Tri& tri, const Vec3& o, const Vec3& d, float tmin, float tmax,
+                    float& t, float& u, float& v) noexcept {
+    const Vec3 p = cross(d, tri.e2);
+    const float det = dot(tri.e1, p);
+    if (det == 0.0f || !std::isfinite(det)) return false;
+    const float inv = 1.0f / det;
+    const Vec3 s = o - tri.v0;
+    u = dot(s, p) * inv;
+    if (!(u >= 0.0f && u <= 1.0f)) return false;
+    const Vec3 q = cross(s, tri.e1);
+    v = dot(d, q) * inv;
+    if (!(v >= 0.0f && u + v <= 1.0f)) return false;
+    t = dot(tri.e2, q) * inv;
+    return t > tmin && t < tmax;
+}
+
+// Real-Time Collision Detection, 5.1.5
+Vec3 closest_on_tri(const BVH::Tri& tri, const Vec3& p) noexcept {
+    const Vec3 a = tri.v0, b = tri.v0 + tri.e1, c = tri.v0 + tri.e2;
+    const Vec3 ab = tri.e1, ac = tri.e2, ap = p - a;
+    const float d1 = dot(ab, ap), d2 = dot(ac, ap);
+    if (d1 <= 0.0f && d2 <= 0.0f) return a;
+    const Vec3 bp = p - b;
+    const float d3 = dot(ab, bp), d4 = dot(ac, bp);
+    if (d3 >= 0.0f && d4 <= d3) return b;
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return a + ab * (d1 / (d1 - d3));
+    const Vec3 cp = p - c;
+    const float d5 = dot(ab, cp), d6 = dot(ac, cp);
+    if (d6 >= 0.0f && d5 <= d6) return c;
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return a + ac * (d2 / (d2 - d6));
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    const float denom = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+inline float box_distance2(const BVH::Node& n, std::size_t k, const Vec3& p) noexcept {
+    const float dx = std::max({n.min_x[k] - p.x, 0.0f, p.x - n.max_x[k]});
+    const float dy = std::max({n.min_y[k] - p.y, 0.0f, p.y - n.max_y[k]});
+    const float dz = std::max({n.min_z[k] - p.z, 0.0f, p.z - n.max_z[k]});
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Push the flagged inner slots far-to-near, so the nearest is popped first
+inline void push_sorted(std::uint32_t* stack, std::size_t& top, const BVH::Node& n,
+                        const float* key, unsigned inner) noexcept {
+    std::uint32_t slot[BVH::width];
+    std::size_t m = 0;
+    for (std::size_t k = 0; k < BVH::width; ++k)
+        if (inner >> k & 1u) slot[m++] = static_cast<std::uint32_t>(k);
+    for (std::size_t i = 1; i < m; ++i) // insertion sort of at most four
+        for (std::size_t j = i; j > 0 && key[slot[j - 1]] < key[slot[j]]; --j) std::swap(slot[j - 1], slot[j]);
+    for (std::size_t i = 0; i < m; ++i) stack[top++] = n.child[slot[i]];
+}
+
+// ---- serialisation ---------------------------------------------------------
+
+constexpr char magic[8] = {'H', 'M', 'B', 'V', 'H', '\0', '\0', '\0'};
+constexpr std::uint32_t version = 1;
+constexpr std::size_t header_size = 48;
+constexpr std::size_t node_bytes = 6 * BVH::width * 4 + 2 * BVH::width * 4;
+constexpr std::size_t tri_bytes = 9 * 4 + 4;
+
+template <class T>
+void put(std::byte*& p, const T& v) {
+    Binary::store_le<T>(v, std::span<std::byte, sizeof(T)>(p, sizeof(T)));
+    p += sizeof(T);
+}
+
+template <class T>
+T get(const std::byte*& p) {
+    const T v = Binary::load_le<T>(std::span<const std::byte, sizeof(T)>(p, sizeof(T)));
+    p += sizeof(T);
+    return v;
+}
+
+void put_vec(std::byte*& p, const Vec3& v) { put(p, v.x); put(p, v.y); put(p, v.z); }
+Vec3 get_vec(const std::byte*& p) {
+    const float x = get<float>(p), y = get<float>(p), z = get<float>(p);
+    return {x, y, z};
+}
+
+} // namespace
+
+// ---- construction ----------------------------------------------------------
+
+struct BVH::Builder {
+    struct BuildNode {
+        Box box;
+        std::uint32_t left = 0, right = 0;
+        std::uint32_t first = 0, count = 0; // count > 0: leaf over order[first, first + count)
+    };
+    struct Split {
+        Box box;
+        bool leaf = true;
+        std::size_t mid = 0;
+    };
+    struct Bins {
+        std::array<std::array<std::uint32_t, max_bins>, 3> count;
+        std::array<std::array<Box, max_bins>, 3> box;
+
+        void clear(unsigned used) noexcept {
+            for (int a = 0; a < 3; ++a)
+                for (unsigned k = 0; k < used; ++k) {
+                    count[a][k] = 0;
+                    box[a][k] = Box{};
+                }
+        }
+    };
+
+    const std::vector<Box>& boxes;
+    const std::vector<Vec3>& centroids;
+    std::vector<std::uint32_t>& order;
+    std::size_t max_leaf;
+    unsigned bins;
+    unsigned threads;
+
+    static int bin_of(float c, float lo, float scale, unsigned bins) noexcept {
+        const float f = (c - lo) * scale;
+        // NaN centroids land in bin 0
+        return f > 0.0f ? (f < static_cast<float>(bins) ? static_cast<int>(f) : static_cast<int>(bins) - 1) : 0;
+    }
+
+    std::size_t chunk_count(std::size_t n, bool parallel) const noexcept {
+        return parallel && threads > 1 && n >= parallel_min_items
+            ? std::min<std::size_t>(threads * 2, n / (parallel_min_items / 4)) : 1;
+    }
+
+    // `scratch` holds the bins of a serial split, so nodes do not allocate
+    Split split(std::size_t b, std::size_t e, int depth, bool parallel, Bins& scratch) {
+        const std::size_t n = e - b;
+        const std::size_t chunks = chunk_count(n, parallel);
+        Split s;
+
+        // Bounds of the boxes and of the centroids
+        Box cbox;
+        if (chunks == 1) {
+            for (std::size_t i = b; i < e; ++i) {
+                grow(s.box, boxes[order[i]]);
+                grow(cbox, centroids[order[i]]);
+            }
+        } else {
+            std::vector<Box> part_box(chunks), part_cbox(chunks);
+            detail::parallel_for(chunks, threads, [&](std::size_t c) {
+                for (std::size_t i = b + n * c / chunks, last = b + n * (c + 1) / chunks; i < last; ++i) {
+                    grow(part_box[c], boxes[order[i]]);
+                    grow(part_cbox[c], centroids[order[i]]);
+                }
+            });
+            for (std::size_t c = 0; c < chunks; ++c) {
+                grow(s.box, part_box[c]);
+                grow(cbox, part_cbox[c]);
+            }
+        }
+        if (n <= 1) return s;
+
+        const Vec3 extent = cbox.max - cbox.min;
+        int widest = 0;
+        for (int a = 1; a < 3; ++a)
+            if (component(extent, a) > component(extent, widest)) widest = a;
+        auto median = [&](int axis) {
+            s.leaf = false;
+            s.mid = b + n / 2;
+            std::nth_element(order.begin() + static_cast<std::ptrdiff_t>(b),
+                             order.begin() + static_cast<std::ptrdiff_t>(s.mid),
+                             order.begin() + static_cast<std::ptrdiff_t>(e),
+                             [&](std::uint32_t x, std::uint32_t y) {
+                                 return component(centroids[x], axis) < component(centroids[y], axis);
+                             });
+        };
+        if (!(component(extent, widest) > 0.0f)) {
+            // Every centroid coincides: no plane separates them
+            if (n > max_leaf) median(widest);
+            return s;
+        }
+        if (depth >= median_depth) {
+            median(widest);
+            return s;
+        }
+
+        // Bin the centroids along every axis with extent
+        std::vector<Bins> part(chunks - 1);
+        scratch.clear(bins);
+        for (Bins& bn : part) bn.clear(bins);
+        float scale[3];
+        for (int a = 0; a < 3; ++a)
+            scale[a] = component(extent, a) > 0.0f ? static_cast<float>(bins) / component(extent, a) : 0.0f;
+        detail::parallel_for(chunks, threads, [&](std::size_t c) {
+            Bins& bn = c ? part[c - 1] : scratch;
+            for (std::size_t i = b + n * c / chunks, last = b + n * (c + 1) / chunks; i < last; ++i) {
+                const std::uint32_t f = order[i];
+                for (int a = 0; a < 3; ++a) {
+                    if (scale[a] == 0.0f) continue;
+                    const int k = bin_of(component(centroids[f], a), component(cbox.min, a), scale[a], bins);
+                    ++bn.count[a][k];
+                    grow(bn.box[a][k], boxes[f]);
+                }
+            }
+        });
+        Bins& all = scratch;
+        for (const Bins& bn : part)
+            for (int a = 0; a < 3; ++a)
+                for (unsigned k = 0; k < bins; ++k) {
+                    all.count[a][k] += bn.count[a][k];
+                    grow(all.box[a][k], bn.box[a][k]);
+                }
+
+        // Sweep the bins-1 planes of each axis: cost of left + right
+        float best = std::numeric_limits<float>::infinity();
+        int best_axis = -1;
+        unsigned best_plane = 0;
+        for (int a = 0; a < 3; ++a) {
+            if (scale[a] == 0.0f) continue;
+            std::array<float, max_bins> right_cost{};
+            Box acc;
+            std::uint32_t cnt = 0;
+            for (unsigned k = bins - 1; k > 0; --k) {
+                grow(acc, all.box[a][k]);
+                cnt += all.count[a][k];
+                right_cost[k] = cnt ? half_area(acc) * static_cast<float>(cnt) : -1.0f;
+            }
+            acc = Box{};
+            cnt = 0;
+            for (unsigned k = 1; k < bins; ++k) {
+                grow(acc, all.box[a][k - 1]);
+                cnt += all.count[a][k - 1];
+                if (cnt == 0 || right_cost[k] < 0.0f) continue; // one side empty
+                const float cost = half_area(acc) * static_cast<float>(cnt) + right_cost[k];
+                if (cost < best) { best = cost; best_axis = a; best_plane = k; }
+            }
+        }
+
+        const float area = half_area(s.box);
+        if (best_axis < 0) {
+            median(widest);
+            return s;
+        }
+        const float split_cost = traversal_cost + (area > 0.0f ? best / area : 0.0f);
+        if (n <= max_leaf && static_cast<float>(n) <= split_cost) return s;
+
+        const float lo = component(cbox.min, best_axis);
+        const auto mid = std::partition(order.begin() + static_cast<std::ptrdiff_t>(b),
+                                        order.begin() + static_cast<std::ptrdiff_t>(e),
+                                        [&](std::uint32_t f) {
+                                            return bin_of(component(centroids[f], best_axis), lo,
+                                                          scale[best_axis], bins) < static_cast<int>(best_plane);
+                                        });
+        s.leaf = false;
+        s.mid = static_cast<std::size_t>(mid - order.begin());
+        return s;
+    }
+
+    std::uint32_t build_serial(std::size_t b, std::size_t e, int depth, std::vector<BuildNode>& nodes,
+                               Bins& scratch) {
+        const auto idx = static_cast<std::uint32_t>(nodes.size());
+        nodes.emplace_back();
+        const Split s = split(b, e, depth, false, scratch);
+        nodes[idx].box = s.box;
+        if (s.leaf) {
+            nodes[idx].first = static_cast<std::uint32_t>(b);
+            nodes[idx].count = static_cast<std::uint32_t>(e - b);
+            return idx;
+        }
+        const std::uint32_t l = build_serial(b, s.mid, depth + 1, nodes, scratch);
+        const std::uint32_t r = build_serial(s.mid, e, depth + 1, nodes, scratch);
+        nodes[idx].left = l;
+        nodes[idx].right = r;
+        return idx;
+    }
+
+    // Split the top levels here (binning in parallel), then build the
+    // remaining subtrees concurrently and splice them in
+    std::vector<BuildNode> build() {
+        std::vector<BuildNode> nodes(1);
+        const std::size_t n = order.size();
+        const std::size_t grain = threads > 1 ? std::max<std::size_t>(4096, n / (std::size_t{threads} * 8)) : n;
+
+        struct Range { std::size_t b, e; int depth; std::uint32_t node; };
+        std::vector<Range> pending{{0, n, 0, 0}}, tasks;
+        auto scratch = std::make_unique<Bins>();
+        while (!pending.empty()) {
+            const Range r = pending.back();
+            pending.pop_back();
+            if (r.e - r.b <= grain) { tasks.push_back(r); continue; }
+            const Split s = split(r.b, r.e, r.depth, true, *scratch);
+            nodes[r.node].box = s.box;
+            if (s.leaf) {
+                nodes[r.node].first = static_cast<std::uint32_t>(r.b);
+                nodes[r.node].count = static_cast<std::uint32_t>(r.e - r.b);
+                continue;
+            }
+            const auto l = static_cast<std::uint32_t>(nodes.size());
+            nodes.resize(nodes.size() + 2);
+            nodes[r.node].left = l;
+            nodes[r.node].right = l + 1;
+            pending.push_back({r.b, s.mid, r.depth + 1, l});
+            pending.push_back({s.mid, r.e, r.depth + 1, l + 1});
+        }
+
+        std::vector<std::vector<BuildNode>> built(tasks.size());
+        detail::parallel_for(tasks.size(), threads, [&](std::size_t t) {
+            auto local = std::make_unique<Bins>();
+            built[t].reserve((tasks[t].e - tasks[t].b) / 2 + 1);
+            build_serial(tasks[t].b, tasks[t].e, tasks[t].depth, built[t], *local);
+        });
+        // A subtree's root replaces its placeholder; node i >= 1 moves to base + i - 1
+        for (std::size_t t = 0; t < tasks.size(); ++t) {
+            const auto base = static_cast<std::uint32_t>(nodes.size());
+            auto remap = [&](BuildNode node) {
+                if (node.count == 0) {
+                    node.left = base + node.left - 1;
+                    node.right = base + node.right - 1;
+                }
+                return node;
+            };
+            nodes[tasks[t].node] = remap(built[t][0]);
+            for (std::size_t i = 1; i < built[t].size(); ++i) nodes.push_back(remap(built[t][i]));
+        }
+        return nodes;
+    }
+
+    // Pull grandchildren up until a node has up to four slots
+    static std::uint32_t collapse(const std::vector<BuildNode>& bn, std::uint32_t i, std::vector<Node>& out) {
+        std::uint32_t slots[width];
+        std::size_t m = 0;
+        if (bn[i].count) {
+            slots[m++] = i;
+        } else {
+            slots[m++] = bn[i].left;
+            slots[m++] = bn[i].right;
+        }
+        while (m < width) {
+            std::size_t pick = width;
+            float biggest = -1.0f;
+            for (std::size_t k = 0; k < m; ++k)
+                if (bn[slots[k]].count == 0 && half_area(bn[slots[k]].box) > biggest) {
+                    biggest = half_area(bn[slots[k]].box);
+                    pick = k;
+                }
+            if (pick == width) break;
+            const BuildNode& inner = bn[slots[pick]];
+            slots[pick] = inner.left;
+            slots[m++] = inner.right;
+        }
+
+        const auto idx = static_cast<std::uint32_t>(out.size());
+        out.emplace_back();
+        for (std::size_t k = 0; k < width; ++k) {
+            Node& node = out[idx];
+            const Box box = k < m ? bn[slots[k]].box : Box{};
+            node.min_x[k] = box.min.x; node.min_y[k] = box.min.y; node.min_z[k] = box.min.z;
+            node.max_x[k] = box.max.x; node.max_y[k] = box.max.y; node.max_z[k] = box.max.z;
+            node.child[k] = empty_slot;
+            node.count[k] = 0;
+            if (k >= m) continue;
+            if (bn[slots[k]].count) {
+                node.child[k] = leaf_bit | bn[slots[k]].first;
+                node.count[k] = bn[slots[k]].count;
+            } else {
+                const std::uint32_t c = collapse(bn, slots[k], out); // may reallocate `out`
+                out[idx].child[k] = c;
+            }
+        }
+        return idx;
+    }
+
+    template <class Get>
+    static BVH run(std::size_t n, Get&& get, const BuildOptions& options) {
+        if (n >= leaf_bit) throw std::length_error("BVH: more than 2^31 - 1 faces");
+        BVH bvh;
+        if (n == 0) return bvh;
+        const unsigned threads = detail::resolve_threads(options.threads);
+
+        std::vector<Tri> input(n);
+        std::vector<Box> boxes(n);
+        std::vector<Vec3> centroids(n);
+        std::vector<std::uint32_t> order(n);
+        detail::parallel_for((n + parallel_min_items - 1) / parallel_min_items, threads, [&](std::size_t c) {
+            for (std::size_t i = c * parallel_min_items, last = std::min(n, i + parallel_min_items); i < last; ++i) {
+                const std::array<Vec3, 3> v = get(i);
+                input[i] = Tri{v[0], v[1] - v[0], v[2] - v[0], static_cast<std::uint32_t>(i)};
+                Box b;
+                for (const Vec3& p : v) grow(b, p);
+                boxes[i] = b;
+                centroids[i] = (b.min + b.max) * 0.5f;
+                order[i] = static_cast<std::uint32_t>(i);
+            }
+        });
+
+        Builder builder{boxes, centroids, order, std::max<std::size_t>(1, options.max_leaf_size),
+                        std::clamp(options.bins, 2u, static_cast<unsigned>(max_bins)), threads};
+        const std::vector<BuildNode> tree = builder.build();
+        bvh.bounds_ = tree[0].box;
+        bvh.nodes_.reserve(tree.size() / 2 + 1);
+        collapse(tree, 0, bvh.nodes_);
+        bvh.tris_.resize(n);
+        for (std::size_t i = 0; i < n; ++i) bvh.tris_[i] = input[order[i]];
+        return bvh;
+    }
+};
+
+BVH BVH::build(std::span<const Triangle> tris, const BuildOptions& options) {
+    return Builder::run(tris.size(), [&](std::size_t i) { return tris[i].v; }, options);
+}
+
+BVH BVH::build(const MeshSoA& mesh, const BuildOptions& options) {
+    return Builder::run(mesh.size(), [&](std::size_t i) {
+        return std::array<Vec3, 3>{mesh.v[0][i], mesh.v[1][i], mesh.v[2][i]};
+    }, options);
+}
+
+BVH BVH::build(const IndexedMesh& mesh, const BuildOptions& options) {
+    return Builder::run(mesh.indices.size(), [&](std::size_t i) {
+        const auto& f = mesh.indices[i];
+        return std::array<Vec3, 3>{mesh.vertices[f[0]], mesh.vertices[f[1]], mesh.vertices[f[2]]};
+    }, options);
+}
+
+// ---- queries ---------------------------------------------------------------
+
+std::optional<RayHit> BVH::intersect(const Ray& ray) const noexcept {
+    if (nodes_.empty()) return std::nullopt;
+    const Vec3 o = ray.origin, d = ray.direction;
+    const Vec3 inv{1.0f / d.x, 1.0f / d.y, 1.0f / d.z};
+    std::optional<RayHit> hit;
+    float tmax = ray.tmax;
+
+    std::uint32_t stack[stack_size];
+    std::size_t top = 0;
+    stack[top++] = 0;
+    while (top) {
+        const Node& node = nodes_[stack[--top]];
+        float tnear[width];
+        unsigned inner = 0;
+        for (std::size_t k = 0; k < width; ++k) {
+            const float x0 = (node.min_x[k] - o.x) * inv.x, x1 = (node.max_x[k] - o.x) * inv.x;
+            const float y0 = (node.min_y[k] - o.y) * inv.y, y1 = (node.max_y[k] - o.y) * inv.y;
+            const float z0 = (node.min_z[k] - o.z) * inv.z, z1 = (node.max_z[k] - o.z) * inv.z;
+            const float t0 = std::max({std::min(x0, x1), std::min(y0, y1), std::min(z0, z1), ray.tmin});
+            const float t1 = std::min({std::max(x0, x1), std::max(y0, y1), std::max(z0, z1), tmax});
+            tnear[k] = t0;
+            if (node.child[k] == empty_slot || !(t0 <= t1)) continue;
+            if (!(node.child[k] & leaf_bit)) { inner |= 1u << k; continue; }
+            const std::uint32_t first = node.child[k] & ~leaf_bit;
+            for (std::uint32_t i = first; i < first + node.count[k]; ++i) {
+                float t, u, v;
+                if (hit_tri(tris_[i], o, d, ray.tmin, tmax, t, u, v)) {
+                    tmax = t;
+                    hit = RayHit{tris_[i].face, t, u, v};
+                }
+            }
+        }
+        push_sorted(stack, top, node, tnear, inner);
+    }
+    return hit;
+}
+
+bool BVH::occluded(const Ray& ray) const noexcept {
+    if (nodes_.empty()) return false;
+    const Vec3 o = ray.origin, d = ray.direction;
+    const Vec3 inv{1.0f / d.x, 1.0f / d.y, 1.0f / d.z};
+
+    std::uint32_t stack[stack_size];
+    std::size_t top = 0;
+    stack[top++] = 0;
+    while (top) {
+        const Node& node = nodes_[stack[--top]];
+        for (std::size_t k = 0; k < width; ++k) {
+            if (node.child[k] == empty_slot) continue;
+            const float x0 = (node.min_x[k] - o.x) * inv.x, x1 = (node.max_x[k] - o.x) * inv.x;
+            const float y0 = (node.min_y[k] - o.y) * inv.y, y1 = (node.max_y[k] - o.y) * inv.y;
+            const float z0 = (node.min_z[k] - o.z) * inv.z, z1 = (node.max_z[k] - o.z) * inv.z;
+            const float t0 = std::max({std::min(x0, x1), std::min(y0, y1), std::min(z0, z1), ray.tmin});
+            const float t1 = std::min({std::max(x0, x1), std::max(y0, y1), std::max(z0, z1), ray.tmax});
+            if (!(t0 <= t1)) continue;
+            if (!(node.child[k] & leaf_bit)) { stack[top++] = node.child[k]; continue; }
+            const std::uint32_t first = node.child[k] & ~leaf_bit;
+            for (std::uint32_t i = first; i < first + node.count[k]; ++i) {
+                float t, u, v;
+                if (hit_tri(tris_[i], o, d, ray.tmin, ray.tmax, t, u, v)) return true;
+            }
+        }
+    }
+    return false;
+}
+
+void BVH::query(const Box& box, std::vector<std::uint32_t>& faces) const {
+    if (nodes_.empty()) return;
+    std::uint32_t stack[stack_size];
+    std::size_t top = 0;
+    stack[top++] = 0;
+    while (top) {
+        const Node& node = nodes_[stack[--top]];
+        for (std::size_t k = 0; k < width; ++k) {
+            if (node.child[k] == empty_slot || !overlaps(slot_box(node, k), box)) continue;
+            if (!(node.child[k] & leaf_bit)) { stack[top++] = node.child[k]; continue; }
+            const std::uint32_t first = node.child[k] & ~leaf_bit;
+            for (std::uint32_t i = first; i < first + node.count[k]; ++i)
+                if (overlaps(tri_box(tris_[i]), box)) faces.push_back(tris_[i].face);
+        }
+    }
+}
+
+std::optional<ClosestPoint> BVH::closest_point(const Vec3& p, float max_distance) const noexcept {
+    if (nodes_.empty()) return std::nullopt;
+    std::optional<ClosestPoint> best;
+    float best2 = max_distance * max_distance;
+
+    std::uint32_t stack[stack_size];
+    float entry[stack_size]; // box distance when pushed; stale entries are skipped
+    std::size_t top = 0;
+    stack[top] = 0;
+    entry[top++] = 0.0f;
+    while (top) {
+        --top;
+        if (entry[top] > best2) continue;
+        const Node& node = nodes_[stack[top]];
+        float d2[width];
+        unsigned inner = 0;
+        for (std::size_t k = 0; k < width; ++k) {
+            d2[k] = box_distance2(node, k, p);
+            if (node.child[k] == empty_slot || !(d2[k] <= best2)) continue;
+            if (!(node.child[k] & leaf_bit)) { inner |= 1u << k; continue; }
+            const std::uint32_t first = node.child[k] & ~leaf_bit;
+            for (std::uint32_t i = first; i < first + node.count[k]; ++i) {
+                const Vec3 q = closest_on_tri(tris_[i], p);
+                const Vec3 dq = q - p;
+                const float dist2 = dot(dq, dq);
+                if (dist2 <= best2) {
+                    best2 = dist2;
+                    best = ClosestPoint{tris_[i].face, q, std::sqrt(dist2)};
+                }
+            }
+        }
+        const std::size_t before = top;
+        push_sorted(stack, top, node, d2, inner);
+        for (std::size_t i = before; i < top; ++i)
+            for (std::size_t k = 0; k < width; ++k)
+                if (node.child[k] == stack[i]) entry[i] = d2[k];
+    }
+    return best;
+}
+
+// ---- serialisation ---------------------------------------------------------
+
+std::vector<std::byte> BVH::encode() const {
+    std::vector<std::byte> out(header_size + nodes_.size() * node_bytes + tris_.size() * tri_bytes);
+    std::byte* p = out.data();
+    std::memcpy(p, magic, sizeof magic);
+    p += sizeof magic;
+    put<std::uint32_t>(p, version);
+    put<std::uint32_t>(p, static_cast<std::uint32_t>(nodes_.size()));
+    put<std::uint32_t>(p, static_cast<std::uint32_t>(tris_.size()));
+    put<std::uint32_t>(p, 0);
+    put_vec(p, bounds_.min);
+    put_vec(p, bounds_.max);
+    for (const Node& n : nodes_) {
+        for (const float* a : {n.min_x, n.min_y, n.min_z, n.max_x, n.max_y, n.max_z})
+            for (std::size_t k = 0; k < width; ++k) put<float>(p, a[k]);
+        for (std::size_t k = 0; k < width; ++k) put<std::uint32_t>(p, n.child[k]);
+        for (std::size_t k = 0; k < width; ++k) put<std::uint32_t>(p, n.count[k]);
+    }
+    for (const Tri& t : tris_) {
+        put_vec(p, t.v0);
+        put_vec(p, t.e1);
+        put_vec(p, t.e2);
+        put<std::uint32_t>(p, t.face);
+    }
+    return out;
+}
+
+std::expected<BVH, std::string> BVH::decode(std::span<const std::byte> bytes) {
+    auto fail = [](std::string_view what) { return std::unexpected(std::format("BVH: {}", what)); };
+    if (bytes.size() < header_size || std::memcmp(bytes.data(), magic, sizeof magic) != 0)
+        return fail("not a Harmony BVH");
+    const std::byte* p = bytes.data() + sizeof magic;
+    if (const auto v = get<std::uint32_t>(p); v != version) return fail(std::format("unsupported version {}", v));
+    const std::size_t node_count = get<std::uint32_t>(p);
+    const std::size_t tri_count = get<std::uint32_t>(p);
+    p += 4;
+    if ((bytes.size() - header_size) / node_bytes < node_count
+        || bytes.size() - header_size - node_count * node_bytes != tri_count * tri_bytes)
+        return fail("size does not match the node and triangle counts");
+    if ((node_count == 0) != (tri_count == 0)) return fail("nodes without triangles");
+
+    BVH bvh;
+    bvh.bounds_.min = get_vec(p);
+    bvh.bounds_.max = get_vec(p);
+    bvh.nodes_.resize(node_count);
+    // Inner nodes from the root down to each node; 0 = no parent seen yet.
+    // Every node but the root has exactly one parent (no shared subtrees)
+    // and no path is deeper than the traversal stack allows.
+    std::vector<std::uint8_t> depth(node_count, 0);
+    if (node_count) depth[0] = 1;
+    for (std::size_t i = 0; i < node_count; ++i) {
+        if (depth[i] == 0) return fail(std::format("node {} has no parent", i));
+        Node& n = bvh.nodes_[i];
+        for (float* a : {n.min_x, n.min_y, n.min_z, n.max_x, n.max_y, n.max_z})
+            for (std::size_t k = 0; k < width; ++k) a[k] = get<float>(p);
+        for (std::size_t k = 0; k < width; ++k) n.child[k] = get<std::uint32_t>(p);
+        for (std::size_t k = 0; k < width; ++k) n.count[k] = get<std::uint32_t>(p);
+        for (std::size_t k = 0; k < width; ++k) {
+            const std::uint32_t c = n.child[k];
+            if (c == empty_slot) continue;
+            // Children after their parent: the traversal cannot loop
+            const bool ok = (c & leaf_bit)
+                ? (c & ~leaf_bit) <= tri_count && n.count[k] <= tri_count - (c & ~leaf_bit)
+                : c > i && c < node_count && n.count[k] == 0;
+            if (!ok) return fail(std::format("node {} has an invalid child", i));
+            if (c & leaf_bit) continue;
+            if (depth[c] != 0) return fail(std::format("node {} has more than one parent", c));
+            if (depth[i] == max_depth) return fail(std::format("node {} is deeper than {} levels", c, max_depth));
+            depth[c] = static_cast<std::uint8_t>(depth[i] + 1);
+        }
+    }
+    bvh.tris_.resize(tri_count);
+    for (Tri& t : bvh.tris_) {
+        t.v0 = get_vec(p);
+        t.e1 = get_vec(p);
+        t.e2 = get_vec(p);
+        t.face = get<std::uint32_t>(p);
+    }
+    return bvh;
+}
+
+} // namespace Harmony::STL
@@ -19,20 +19,331 @@
 #include <expected>
 #include <type_traits>
 #include <cstring>   // std::memcpy
+#include <format>
+#include <limits>
+#include <vector>
 
 #include "Harmony/STL/Mesh.h"
 #include "Harmony/STL/Binary.h"
+#include "Harmony/STL/MappedFile.h"
+#include "Harmony/STL/Normals.h"
+#include "FinishFaces.h"
+#include "Instrument.h"
+#include "Parallel.h"
+#include "ParseConfigs.h"
 
 namespace Harmony::STL::Binary {  
 
     using namespace Harmony::STL;
 
+namespace {
+
+using STL::detail::PhaseTimer;
+using STL::detail::StatsScope;
+
+constexpr std::size_t stream_block_records = 4096;
+constexpr std::size_t normal_block = 1024; // triangles fixed up per batch when writing
+constexpr std::size_t parallel_slice_records = 64 * 1024; // ~3 MiB of records per task
+constexpr std::size_t write_block_records = 20 * 1024;    // ~1 MiB per os.write
+
+/// Decode `count` records; their attribute words go to `attributes` when set
+void decode_records(const std::byte* src, std::size_t count, Triangle* dst,
+                    std::uint16_t* attributes = nullptr) noexcept {
+    if (!attributes) {
+        for (std::size_t i = 0; i < count; ++i, src += record_size) dst[i] = decode_record(src);
+        return;
+    }
+    for (std::size_t i = 0; i < count; ++i, src += record_size) {
+        dst[i] = decode_record(src);
+        attributes[i] = load_le<std::uint16_t>(std::span<const std::byte, 2>(src + 48, 2));
+    }
+}
+
+/// Encode `count` triangles into count * record_size bytes at `dst`,
+/// filling missing normals on a local copy. Each record gets its word from
+/// `attributes` if set, else `attribute_byte_count`.
+void encode_records(const Triangle* src, const std::uint16_t* attributes, std::size_t count,
+                    std::uint16_t attribute_byte_count, std::byte* dst) {
+    std::array<Triangle, normal_block> block;
+    for (std::size_t first = 0; first < count; first += normal_block) {
+        const std::size_t n = std::min(normal_block, count - first);
+        std::copy_n(src + first, n, block.begin());
+        {
+            const PhaseTimer timer(&Stats::normals);
+            STL::detail::count(&Stats::normals_computed, fill_missing_normals(std::span<Triangle>(block.data(), n)));
+        }
+        const PhaseTimer timer(&Stats::encode);
+        for (std::size_t j = 0; j < n; ++j, dst += record_size)
+            encode_record(block[j], attributes ? attributes[first + j] : attribute_byte_count, dst);
+    }
+}
+
+std::size_t slice_count(std::size_t records) noexcept {
+    return (records + parallel_slice_records - 1) / parallel_slice_records;
+}
+
+/// Header truncated/zero-padded to 80 bytes, then the uint32 LE count
+void encode_prefix(std::string_view header, std::size_t count, std::byte* dst) noexcept {
+    std::memset(dst, 0, header_size);
+    if (!header.empty()) std::memcpy(dst, header.data(), std::min(header_size, header.size()));
+    store_le<std::uint32_t>(static_cast<std::uint32_t>(count),
+                            std::span<std::byte, 4>(dst + header_size, 4));
+}
+
+/// encode_records() over tris[first, first + count), split into slices
+/// across `threads` when the range is large enough to pay for it
+void encode_range(const Mesh& mesh, std::size_t first, std::size_t count,
+                  std::uint16_t attribute_byte_count, std::byte* dst, unsigned threads) {
+    const bool per_face = !mesh.attributes.empty() && mesh.attributes.size() == mesh.tris.size();
+    const std::uint16_t* attributes = per_face ? mesh.attributes.data() + first : nullptr;
+    if (threads <= 1 || count < 2 * parallel_slice_records) {
+        encode_records(mesh.tris.data() + first, attributes, count, attribute_byte_count, dst);
+        return;
+    }
+    const PhaseTimer timer(&Stats::encode);
+    STL::detail::parallel_for(slice_count(count), threads, [&](std::size_t s) {
+        const std::size_t offset = s * parallel_slice_records;
+        encode_records(mesh.tris.data() + first + offset, attributes ? attributes + offset : nullptr,
+                       std::min(parallel_slice_records, count - offset),
+                       attribute_byte_count, dst + offset * record_size);
+    });
+}
+
+/// Decode `count` records starting at `records` into `mesh` (replacing its
+/// contents but keeping its capacity); large inputs are split into slices
+/// across threads
+template <class A>
+void decode_into(const std::byte* records, std::size_t count, std::string_view name, BasicMesh<A>& mesh,
+                 bool compute_missing_normals, unsigned threads, GeometryStats* geometry = nullptr,
+                 bool keep_attributes = false) {
+    mesh.name.assign(name);
+    STL::detail::count(&Stats::bytes_read, count * record_size);
+    STL::detail::count(&Stats::facets, count);
+    if (mesh.tris.capacity() < count) STL::detail::count(&Stats::reallocations);
+    mesh.tris.resize(count);
+    if (keep_attributes) mesh.attributes.resize(count);
+    else mesh.attributes.clear();
+    std::uint16_t* attributes = keep_attributes ? mesh.attributes.data() : nullptr;
+    if (geometry) *geometry = {};
+    if (threads <= 1 || count < 2 * parallel_slice_records) {
+        {
+            const PhaseTimer timer(&Stats::decode);
+            decode_records(records, count, mesh.tris.data(), attributes);
+        }
+        if (compute_missing_normals || geometry) {
+            const PhaseTimer timer(&Stats::normals);
+            STL::detail::count(&Stats::normals_computed,
+                               STL::detail::finish_faces(mesh.tris, compute_missing_normals, geometry));
+        }
+        return;
+    }
+    // Record i always lands in tris[i], whichever thread decodes it; each
+    // slice is measured while it is still in cache
+    const PhaseTimer timer(&Stats::decode);
+    std::vector<GeometryStats> measured(geometry ? slice_count(count) : 0);
+    STL::detail::parallel_for(slice_count(count), threads, [&](std::size_t s) {
+        const std::size_t first = s * parallel_slice_records;
+        const std::size_t n = std::min(parallel_slice_records, count - first);
+        decode_records(records + first * record_size, n, mesh.tris.data() + first,
+                       attributes ? attributes + first : nullptr);
+        STL::detail::finish_faces(std::span<Triangle>(mesh.tris.data() + first, n), compute_missing_normals,
+                                  geometry ? &measured[s] : nullptr);
+    });
+    for (const GeometryStats& g : measured) geometry->merge(g);
+}
+
+/// The whole of `view`; the byte count includes the 84-byte prefix
+template <class A>
+void decode_into(const View& view, BasicMesh<A>& mesh, bool compute_missing_normals, unsigned threads,
+                 GeometryStats* geometry = nullptr, bool keep_attributes = false) {
+    STL::detail::count(&Stats::bytes_read, prefix_size);
+    decode_into(view.header().data() + prefix_size, view.size(), view.name(), mesh, compute_missing_normals,
+                threads, geometry, keep_attributes);
+}
+
+/// Fails when `count` triangles would take more than options.memory_limit
+std::expected<void, std::string> check_memory(std::size_t count, const ParseOptions& options) {
+    if (options.memory_limit == 0) return {};
+    const std::size_t per_face = sizeof(Triangle) + (options.keep_attributes ? sizeof(std::uint16_t) : 0);
+    if (count <= options.memory_limit / per_face) return {};
+    return std::unexpected(std::format("Binary STL: {} triangles need {} bytes, over the {}-byte memory limit",
+                                       count, count * per_face, options.memory_limit));
+}
+
+/// The format's triangle count is 32 bits
+constexpr bool countable(const Mesh& mesh) noexcept {
+    return mesh.tris.size() <= std::numeric_limits<std::uint32_t>::max();
+}
+
+} // namespace
+
+std::string header_name(std::span<const std::byte, header_size> header) {
+    std::string name(reinterpret_cast<const char*>(header.data()), header_size);
+    // shrink trailing NULs/spaces
+    auto pos = name.find_last_not_of(std::string("\0 \t\r\n", 5));
+    return (pos == std::string::npos) ? std::string{} : name.substr(0, pos + 1);
+}
+
+std::expected<Mesh, std::string> parse(std::string_view text, bool compute_missing_normals) noexcept {
+    const StatsScope scope("Binary::parse");
+    // Validates the payload length before anything is allocated for it
+    auto view = View::open(text);
+    if (!view) return std::unexpected(view.error());
+    Mesh mesh;
+    decode_into(*view, mesh, compute_missing_normals, 1);
+    return mesh;
+}
+
+std::expected<pmr::Mesh, std::string>
+parse(std::string_view text, std::pmr::memory_resource* resource, bool compute_missing_normals) noexcept {
+    const StatsScope scope("Binary::parse");
+    auto view = View::open(text);
+    if (!view) return std::unexpected(view.error());
+    pmr::Mesh mesh(resource);
+    decode_into(*view, mesh, compute_missing_normals, 1);
+    return mesh;
+}
+
+std::expected<void, std::string>
+parse_into(std::string_view text, Mesh& mesh, const ParseOptions& options) {
+    const StatsScope scope("Binary::parse");
+    auto view = View::open(text);
+    std::expected<void, std::string> fits = view ? check_memory(view->size(), options) : std::unexpected(view.error());
+    if (!fits) {
+        mesh.tris.clear();
+        mesh.attributes.clear();
+        if (options.geometry) *options.geometry = {};
+        return fits;
+    }
+    decode_into(*view, mesh, options.compute_missing_normals,
+                STL::detail::resolve_threads(options.threads), options.geometry, options.keep_attributes);
+    return {};
+}
+
+std::expected<Mesh, std::string> parse(std::string_view text, const ParseOptions& options) {
+    Mesh mesh;
+    if (auto r = parse_into(text, mesh, options); !r) return std::unexpected(std::move(r.error()));
+    return mesh;
+}
+
+std::expected<Mesh, std::string>
+parse_range(std::string_view text, std::size_t first, std::size_t count, const ParseOptions& options) {
+    const StatsScope scope("Binary::parse_range");
+    auto view = View::open(text);
+    if (!view) {
+        if (options.geometry) *options.geometry = {};
+        return std::unexpected(view.error());
+    }
+    first = std::min(first, view->size());
+    count = std::min(count, view->size() - first);
+    if (auto fits = check_memory(count, options); !fits) {
+        if (options.geometry) *options.geometry = {};
+        return std::unexpected(std::move(fits.error()));
+    }
+    Mesh mesh;
+    decode_into(view->header().data() + prefix_size + first * record_size, count, view->name(), mesh,
+                options.compute_missing_normals, STL::detail::resolve_threads(options.threads), options.geometry,
+                options.keep_attributes);
+    return mesh;
+}
+
+std::expected<Mesh, std::string>
+parse_range(const std::filesystem::path& path, std::size_t first, std::size_t count, const ParseOptions& options) {
+    auto mapped = MappedFile::open(path);
+    if (!mapped) return std::unexpected(std::format("Binary STL: {}", mapped.error()));
+    return parse_range(mapped->view(), first, count, options);
+}
+
+std::expected<MeshSoA, std::string> parse_soa(std::string_view text, bool compute_missing_normals) noexcept {
+    const StatsScope scope("Binary::parse_soa");
+    auto view = View::open(text);
+    if (!view) return std::unexpected(view.error());
+
+    MeshSoA mesh;
+    mesh.name = view->name();
+    mesh.resize(view->size());
+    STL::detail::count(&Stats::bytes_read, serialized_size(view->size()));
+    STL::detail::count(&Stats::facets, view->size());
+    {
+        const PhaseTimer timer(&Stats::decode);
+        for (std::size_t i = 0; i < view->size(); ++i) mesh.set(i, (*view)[i]);
+    }
+    if (compute_missing_normals) {
+        const PhaseTimer timer(&Stats::normals);
+        STL::detail::count(&Stats::normals_computed, fill_missing_normals(mesh));
+    }
+    return mesh;
+}
+
+template <ParseConfig Config>
+std::expected<ParsedMesh<Config>, std::string> parse(std::string_view text) {
+    const StatsScope scope("Binary::parse");
+    auto view = View::open(text);
+    if (!view) return std::unexpected(view.error());
+    const std::size_t n = view->size();
+    STL::detail::count(&Stats::bytes_read, serialized_size(n));
+    STL::detail::count(&Stats::facets, n);
+
+    ParsedMesh<Config> mesh;
+    mesh.name = view->name();
+    if constexpr (Config.layout == MeshLayout::soa) {
+        mesh.resize(n);
+        {
+            const PhaseTimer timer(&Stats::decode);
+            for (std::size_t i = 0; i < n; ++i) mesh.set(i, (*view)[i]);
+        }
+        const PhaseTimer timer(&Stats::normals);
+        if constexpr (Config.normals == NormalPolicy::fill_missing)
+            STL::detail::count(&Stats::normals_computed, fill_missing_normals(mesh));
+        else if constexpr (Config.normals == NormalPolicy::recompute) {
+            recompute_normals(mesh);
+            STL::detail::count(&Stats::normals_computed, n);
+        }
+    } else {
+        mesh.tris.resize(n);
+        const PhaseTimer timer(&Stats::decode);
+        const std::byte* records = view->header().data() + prefix_size;
+        for (std::size_t first = 0; first < n; first += stream_block_records) {
+            const std::size_t count = std::min(stream_block_records, n - first);
+            const std::span<Triangle> block(mesh.tris.data() + first, count);
+            decode_records(records + first * record_size, count, block.data());
+            if constexpr (Config.normals == NormalPolicy::fill_missing)
+                STL::detail::count(&Stats::normals_computed, fill_missing_normals(block));
+            else if constexpr (Config.normals == NormalPolicy::recompute) {
+                recompute_normals(block);
+                STL::detail::count(&Stats::normals_computed, count);
+            }
+        }
+    }
+    return mesh;
+}
+
+#define HARMONY_INSTANTIATE(Config) \
+    template std::expected<ParsedMesh<Config>, std::string> parse<Config>(std::string_view);
+HARMONY_FOR_EACH_PARSE_CONFIG(HARMONY_INSTANTIATE)
+#undef HARMONY_INSTANTIATE
+
+std::expected<Mesh, std::string> load(const std::filesystem::path& path, bool compute_missing_normals) {
+    const StatsScope scope("Binary::load");
+    auto mapped = MappedFile::open(path);
+    if (!mapped) return std::unexpected(std::format("Binary STL: {}", mapped.error()));
+    return parse(mapped->view(), compute_missing_normals);
+}
+
+std::expected<Mesh, std::string> load(const std::filesystem::path& path, const ParseOptions& options) {
+    const StatsScope scope("Binary::load");
+    auto mapped = MappedFile::open(path);
+    if (!mapped) return std::unexpected(std::format("Binary STL: {}", mapped.error()));
+    return parse(mapped->view(), options);
+}
+
     std::expected<Mesh, std::string> parse(std::istream& is, bool compute_missing_normals) {
+    const StatsScope scope("Binary::parse");
     Mesh mesh;
     mesh.tris.clear();
 
     // Header (80 bytes) + uint32 count
-    std::byte header[80];
+    std::byte header[header_size];
     if (!read_exact(is, header)) {
         return std::unexpected(std::string("Binary STL: failed to read 80-byte header"));
     }
@@ -44,40 +355,40 @@ namespace Harmony::STL::Binary {
     const std::uint32_t triCount = load_le<std::uint32_t>(std::span<const std::byte,4>(countBuf, 4));
 
     // Optional: set mesh name from header (trim trailing zeros/spaces)
-    {
-        std::string name(reinterpret_cast<const char*>(header), 80);
-        // shrink trailing NULs/spaces
-        auto pos = name.find_last_not_of(std::string("\0 \t\r\n", 5));
-        mesh.name = (pos == std::string::npos) ? std::string{} : name.substr(0, pos + 1);
-    }
+    mesh.name = header_name(header);
 
-    mesh.tris.reserve(triCount);
+    // A seekable stream must hold every record before the count is trusted
+    // with an allocation; otherwise the mesh grows as records arrive, and a
+    // bad count fails at EOF having allocated no more than was read
+    const auto left = remaining_bytes(is);
+    if (left && *left / record_size < triCount)
+        return std::unexpected(std::string("Binary STL: unexpected EOF in triangle data"));
+    mesh.tris.reserve(left ? triCount : std::min<std::size_t>(triCount, stream_block_records));
 
-    // Each triangle: normal(3f) + v0(3f) + v1(3f) + v2(3f) + attr(2B)
-    std::byte rec[50]; // 12 floats * 4 = 48 + 2 attribute bytes
-    for (std::uint32_t i = 0; i < triCount; ++i) {
-        if (!read_exact(is, rec)) {
-            return std::unexpected(std::string("Binary STL: unexpected EOF in triangle data"));
-        }
-        const auto f = [&](size_t idx)->float {
-            std::span<const std::byte,4> s{rec + idx*4, 4};
-            return load_le<float>(s);
-        };
-
-        Triangle t{};
-        t.normal = Vec3{ f(0),  f(1),  f(2)  };
-        t.v[0]   = Vec3{ f(3),  f(4),  f(5)  };
-        t.v[1]   = Vec3{ f(6),  f(7),  f(8)  };
-        t.v[2]   = Vec3{ f(9),  f(10), f(11) };
-
-        // attribute byte count: last 2 bytes (ignored)
-        // If normal is zero and requested, compute
-        if (compute_missing_normals) {
-            if (std::abs(t.normal.x) + std::abs(t.normal.y) + std::abs(t.normal.z) < 1e-20f) {
-                t.normal = face_normal(t);
+    // Read whole blocks of records instead of one 50-byte read per triangle
+    std::vector<std::byte> block(std::min<std::size_t>(triCount, stream_block_records) * record_size);
+    for (std::size_t done = 0; done < triCount;) {
+        const std::size_t n = std::min<std::size_t>(triCount - done, stream_block_records);
+        {
+            const PhaseTimer timer(&Stats::io);
+            if (!read_exact(is, std::span<std::byte>(block.data(), n * record_size))) {
+                return std::unexpected(std::string("Binary STL: unexpected EOF in triangle data"));
             }
         }
-        mesh.tris.push_back(t);
+        mesh.tris.resize(done + n);
+        {
+            const PhaseTimer timer(&Stats::decode);
+            decode_records(block.data(), n, mesh.tris.data() + done);
+        }
+        done += n;
+    }
+    STL::detail::count(&Stats::bytes_read, serialized_size(triCount));
+    STL::detail::count(&Stats::facets, triCount);
+
+    // If normal is zero and requested, compute
+    if (compute_missing_normals) {
+        const PhaseTimer timer(&Stats::normals);
+        STL::detail::count(&Stats::normals_computed, fill_missing_normals(mesh.tris));
     }
 
     return mesh;
@@ -87,45 +398,72 @@ bool serialize(std::ostream& os,
                       const Mesh& mesh,
                       std::string_view header,
                       std::uint16_t attribute_byte_count) {
-    // 80-byte header
-    std::byte hdr[80]{};
-    // copy header truncated/padded
-    const size_t copyN = std::min<size_t>(80, header.size());
-    std::memcpy(hdr, header.data(), copyN);
-    if (!write_exact(os, std::span<const std::byte>(hdr, 80))) return false;
-
-    // triangle count (uint32 LE)
-    std::byte cnt[4];
-    store_le<std::uint32_t>(static_cast<std::uint32_t>(mesh.tris.size()),
-                            std::span<std::byte,4>(cnt, 4));
-    if (!write_exact(os, cnt)) return false;
-
-    // records
-    std::byte rec[50];
-    for (const auto& tIn : mesh.tris) {
-        // ensure nonzero normal for better compatibility
-        Triangle t = tIn;
-        if (std::abs(t.normal.x)+std::abs(t.normal.y)+std::abs(t.normal.z) < 1e-20f)
-            t.normal = face_normal(t);
-
-        const float vals[12] = {
-            t.normal.x, t.normal.y, t.normal.z,
-            t.v[0].x,   t.v[0].y,   t.v[0].z,
-            t.v[1].x,   t.v[1].y,   t.v[1].z,
-            t.v[2].x,   t.v[2].y,   t.v[2].z
-        };
-        for (size_t i=0;i<12;++i) {
-            store_le<float>(vals[i],
-                std::span<std::byte,4>{rec + i*4, 4});
-        }
-        // attribute bytes
-        store_le<std::uint16_t>(attribute_byte_count,
-            std::span<std::byte,2>{rec + 48, 2});
+    return serialize(os, mesh, SerializeOptions{}, header, attribute_byte_count);
+}
 
-        if (!write_exact(os, std::span<const std::byte>(rec, 50))) return false;
+bool serialize(std::ostream& os,
+               const Mesh& mesh,
+               const SerializeOptions& options,
+               std::string_view header,
+               std::uint16_t attribute_byte_count) {
+    const StatsScope scope("Binary::serialize");
+    if (!countable(mesh)) return false;
+    STL::detail::count(&Stats::facets, mesh.tris.size());
+    auto write = [&](std::span<const std::byte> bytes) {
+        const PhaseTimer timer(&Stats::io);
+        STL::detail::count(&Stats::bytes_written, bytes.size());
+        return write_exact(os, bytes);
+    };
+    std::byte prefix[prefix_size];
+    encode_prefix(header, mesh.tris.size(), prefix);
+    if (!write(prefix)) return false;
+
+    // Records are encoded a block at a time and each block goes out in one
+    // write; with threads, a block holds a few slices per thread
+    const unsigned threads = STL::detail::resolve_threads(options.threads);
+    const std::size_t block_records = threads <= 1 || mesh.tris.size() < 2 * parallel_slice_records
+        ? write_block_records
+        : parallel_slice_records * threads * 2;
+    std::vector<std::byte> out(std::min(block_records, mesh.tris.size()) * record_size);
+    for (std::size_t first = 0; first < mesh.tris.size(); first += block_records) {
+        const std::size_t n = std::min(block_records, mesh.tris.size() - first);
+        encode_range(mesh, first, n, attribute_byte_count, out.data(), threads);
+        if (!write(std::span<const std::byte>(out.data(), n * record_size))) return false;
     }
     return static_cast<bool>(os);
 }
 
-  
-} // namespace Harmony::STL::Binary
\ No newline at end of file
+std::expected<std::size_t, std::string>
+serialize(std::span<std::byte> out,
+          const Mesh& mesh,
+          std::string_view header,
+          std::uint16_t attribute_byte_count,
+          const SerializeOptions& options) {
+    const StatsScope scope("Binary::serialize");
+    if (!countable(mesh))
+        return std::unexpected(std::format("Binary STL: {} triangles do not fit the 32-bit triangle count",
+                                           mesh.tris.size()));
+    const std::size_t size = serialized_size(mesh);
+    if (out.size() < size)
+        return std::unexpected(std::format("Binary STL: output buffer too small ({} bytes, need {})",
+                                           out.size(), size));
+    encode_prefix(header, mesh.tris.size(), out.data());
+    encode_range(mesh, 0, mesh.tris.size(), attribute_byte_count, out.data() + prefix_size,
+                 STL::detail::resolve_threads(options.threads));
+    STL::detail::count(&Stats::facets, mesh.tris.size());
+    STL::detail::count(&Stats::bytes_written, size);
+    return size;
+}
+
+std::vector<std::byte> serialize(const Mesh& mesh,
+                                 std::string_view header,
+                                 std::uint16_t attribute_byte_count,
+                                 const SerializeOptions& options) {
+    const StatsScope scope("Binary::serialize");
+    if (!countable(mesh)) return {};
+    std::vector<std::byte> out(serialized_size(mesh));
+    (void)serialize(std::span<std::byte>(out), mesh, header, attribute_byte_count, options);
+    return out;
+}
+
+} // namespace Harmony::STL::Binary
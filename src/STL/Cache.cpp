@@ -0,0 +1,752 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <optional>
+
+#ifdef HARMONY_HAVE_LZ4
+    #include <lz4.h>
+#endif
+#ifdef HARMONY_HAVE_ZSTD
+    #include <zstd.h>
+#endif
+
+#include "Harmony/STL/Cache.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/MappedFile.h"
+#include "Harmony/STL/Parse.h"
+#include "Parallel.h"
+
+namespace Harmony::STL {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// File layout, little-endian throughout:
+//   header (header_size bytes, offsets below)
+//   mesh name (name_size bytes)
+//   block table (block_count entries of entry_size bytes)
+//   block payloads
+// Blocks cover the vertex, index and normal streams in that order, each
+// split into runs of block_items items, so the table is implied by the
+// counts and every block decodes on its own.
+constexpr char magic[8] = {'H', 'M', 'C', 'A', 'C', 'H', 'E', '\0'};
+constexpr std::uint32_t version = 1;
+constexpr std::size_t header_size = 96;
+constexpr std::size_t entry_size = 16;
+constexpr std::size_t max_block_items = std::size_t{1} << 20;
+
+enum Flags : std::uint32_t {
+    quantized = 1u << 0,
+    normals = 1u << 1,
+    oct = 1u << 2,
+    filled_normals = 1u << 3, // source parsed with compute_missing_normals
+    known_flags = quantized | normals | oct | filled_normals,
+};
+
+enum class Stream : std::uint8_t { vertices = 0, indices = 1, normals = 2 };
+
+constexpr std::uint16_t quant_max = 65535;
+constexpr std::int16_t oct_zero = std::numeric_limits<std::int16_t>::min(); // never produced for a real normal
+
+template <class T>
+void put(std::byte* p, const T& v) {
+    Binary::store_le<T>(v, std::span<std::byte, sizeof(T)>(p, sizeof(T)));
+}
+
+template <class T>
+T get(const std::byte* p) {
+    return Binary::load_le<T>(std::span<const std::byte, sizeof(T)>(p, sizeof(T)));
+}
+
+std::unexpected<std::string> cache_error(std::string_view what) {
+    return std::unexpected(std::format("Mesh cache: {}", what));
+}
+
+// ---- codecs ----------------------------------------------------------------
+
+std::size_t compress_bound(CacheCodec codec, [[maybe_unused]] std::size_t n) noexcept {
+    switch (codec) {
+#ifdef HARMONY_HAVE_LZ4
+    case CacheCodec::lz4: return static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(n)));
+#endif
+#ifdef HARMONY_HAVE_ZSTD
+    case CacheCodec::zstd: return ZSTD_compressBound(n);
+#endif
+    default: return 0;
+    }
+}
+
+// Size of the compressed data in `out`, or nothing if the codec failed
+std::optional<std::size_t> compress(CacheCodec codec, [[maybe_unused]] int level,
+                                    [[maybe_unused]] std::span<const std::byte> in,
+                                    [[maybe_unused]] std::span<std::byte> out) noexcept {
+    switch (codec) {
+#ifdef HARMONY_HAVE_LZ4
+    case CacheCodec::lz4: {
+        const int n = LZ4_compress_default(reinterpret_cast<const char*>(in.data()),
+                                           reinterpret_cast<char*>(out.data()),
+                                           static_cast<int>(in.size()), static_cast<int>(out.size()));
+        if (n <= 0) return std::nullopt;
+        return static_cast<std::size_t>(n);
+    }
+#endif
+#ifdef HARMONY_HAVE_ZSTD
+    case CacheCodec::zstd: {
+        const std::size_t n = ZSTD_compress(out.data(), out.size(), in.data(), in.size(),
+                                            level != 0 ? level : 3);
+        if (ZSTD_isError(n)) return std::nullopt;
+        return n;
+    }
+#endif
+    default: return std::nullopt;
+    }
+}
+
+// True if `in` decompressed to exactly out.size() bytes
+bool decompress(CacheCodec codec, [[maybe_unused]] std::span<const std::byte> in,
+                [[maybe_unused]] std::span<std::byte> out) noexcept {
+    switch (codec) {
+#ifdef HARMONY_HAVE_LZ4
+    case CacheCodec::lz4: {
+        const int n = LZ4_decompress_safe(reinterpret_cast<const char*>(in.data()),
+                                          reinterpret_cast<char*>(out.data()),
+                                          static_cast<int>(in.size()), static_cast<int>(out.size()));
+        return n >= 0 && static_cast<std::size_t>(n) == out.size();
+    }
+#endif
+#ifdef HARMONY_HAVE_ZSTD
+    case CacheCodec::zstd: {
+        const std::size_t n = ZSTD_decompress(out.data(), out.size(), in.data(), in.size());
+        return !ZSTD_isError(n) && n == out.size();
+    }
+#endif
+    default: return false;
+    }
+}
+
+// Most raw bytes one stored byte can stand for: an LZ4 length grows by
+// 255 per byte, a 4-byte zstd RLE block covers up to 128 KiB
+std::size_t max_expansion(CacheCodec codec) noexcept {
+    switch (codec) {
+    case CacheCodec::lz4: return 255;
+    case CacheCodec::zstd: return 32 * 1024;
+    default: return 1;
+    }
+}
+
+std::string_view codec_name(CacheCodec codec) noexcept {
+    switch (codec) {
+    case CacheCodec::none: return "none";
+    case CacheCodec::lz4: return "LZ4";
+    case CacheCodec::zstd: return "zstd";
+    }
+    return "unknown";
+}
+
+// ---- item encodings --------------------------------------------------------
+
+struct Layout {
+    std::uint32_t flags = 0;
+    std::size_t vertex_count = 0, face_count = 0;
+    std::size_t block_items = 0;
+    Vec3 min{}, max{};
+
+    [[nodiscard]] std::size_t items(Stream s) const noexcept {
+        if (s == Stream::vertices) return vertex_count;
+        if (s == Stream::normals && !(flags & normals)) return 0;
+        return face_count;
+    }
+    [[nodiscard]] std::size_t stride(Stream s) const noexcept {
+        switch (s) {
+        case Stream::vertices: return (flags & quantized) ? 3 * sizeof(std::uint16_t) : 3 * sizeof(float);
+        case Stream::indices: return 3 * sizeof(std::uint32_t);
+        case Stream::normals: return (flags & oct) ? 2 * sizeof(std::int16_t) : 3 * sizeof(float);
+        }
+        return 0;
+    }
+};
+
+struct Block {
+    Stream stream;
+    std::size_t first, count;
+};
+
+std::vector<Block> plan_blocks(const Layout& layout) {
+    std::vector<Block> blocks;
+    for (Stream s : {Stream::vertices, Stream::indices, Stream::normals}) {
+        const std::size_t n = layout.items(s);
+        for (std::size_t first = 0; first < n; first += layout.block_items)
+            blocks.push_back({s, first, std::min(layout.block_items, n - first)});
+    }
+    return blocks;
+}
+
+std::uint16_t quantize(float v, float lo, float scale) noexcept {
+    const double q = std::round((static_cast<double>(v) - lo) * scale);
+    return static_cast<std::uint16_t>(std::clamp(q, 0.0, static_cast<double>(quant_max)));
+}
+
+float dequantize(std::uint16_t q, float lo, double step) noexcept {
+    return static_cast<float>(lo + q * step);
+}
+
+// Octahedral normal encoding: project onto the L1 unit octahedron and fold
+// the lower hemisphere over the upper one
+std::array<std::int16_t, 2> oct_encode(const Vec3& n) noexcept {
+    const float l1 = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    if (!std::isfinite(l1) || l1 <= 0.0f) return {oct_zero, oct_zero};
+    float x = n.x / l1, y = n.y / l1;
+    if (n.z < 0.0f) {
+        const float fx = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float fy = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+    auto snorm = [](float v) {
+        return static_cast<std::int16_t>(std::lround(std::clamp(v, -1.0f, 1.0f) * 32767.0f));
+    };
+    return {snorm(x), snorm(y)};
+}
+
+Vec3 oct_decode(std::int16_t a, std::int16_t b) noexcept {
+    if (a == oct_zero && b == oct_zero) return {};
+    float x = std::max(a / 32767.0f, -1.0f), y = std::max(b / 32767.0f, -1.0f);
+    const float z = 1.0f - std::abs(x) - std::abs(y);
+    const float t = std::max(-z, 0.0f);
+    x += x >= 0.0f ? -t : t;
+    y += y >= 0.0f ? -t : t;
+    const float len = std::sqrt(x * x + y * y + z * z);
+    return Vec3{x / len, y / len, z / len};
+}
+
+void encode_items(const IndexedMesh& mesh, const Layout& layout, const Block& b, std::byte* out) {
+    const std::size_t stride = layout.stride(b.stream);
+    switch (b.stream) {
+    case Stream::vertices:
+        if (layout.flags & quantized) {
+            const float lo[3] = {layout.min.x, layout.min.y, layout.min.z};
+            const float ext[3] = {layout.max.x - lo[0], layout.max.y - lo[1], layout.max.z - lo[2]};
+            float scale[3];
+            for (int k = 0; k < 3; ++k) scale[k] = ext[k] > 0.0f ? quant_max / ext[k] : 0.0f;
+            for (std::size_t i = 0; i < b.count; ++i) {
+                const Vec3& p = mesh.vertices[b.first + i];
+                std::byte* o = out + i * stride;
+                put<std::uint16_t>(o + 0, quantize(p.x, lo[0], scale[0]));
+                put<std::uint16_t>(o + 2, quantize(p.y, lo[1], scale[1]));
+                put<std::uint16_t>(o + 4, quantize(p.z, lo[2], scale[2]));
+            }
+        } else {
+            for (std::size_t i = 0; i < b.count; ++i) {
+                const Vec3& p = mesh.vertices[b.first + i];
+                std::byte* o = out + i * stride;
+                put<float>(o + 0, p.x);
+                put<float>(o + 4, p.y);
+                put<float>(o + 8, p.z);
+            }
+        }
+        break;
+    case Stream::indices:
+        for (std::size_t i = 0; i < b.count; ++i)
+            for (std::size_t k = 0; k < 3; ++k)
+                put<std::uint32_t>(out + i * stride + k * 4, mesh.indices[b.first + i][k]);
+        break;
+    case Stream::normals:
+        for (std::size_t i = 0; i < b.count; ++i) {
+            const Vec3& n = mesh.normals[b.first + i];
+            std::byte* o = out + i * stride;
+            if (layout.flags & oct) {
+                const auto e = oct_encode(n);
+                put<std::int16_t>(o + 0, e[0]);
+                put<std::int16_t>(o + 2, e[1]);
+            } else {
+                put<float>(o + 0, n.x);
+                put<float>(o + 4, n.y);
+                put<float>(o + 8, n.z);
+            }
+        }
+        break;
+    }
+}
+
+// False if an index points past the vertices
+bool decode_items(const std::byte* in, const Layout& layout, const Block& b, IndexedMesh& mesh) {
+    const std::size_t stride = layout.stride(b.stream);
+    switch (b.stream) {
+    case Stream::vertices:
+        if (layout.flags & quantized) {
+            const float lo[3] = {layout.min.x, layout.min.y, layout.min.z};
+            double step[3];
+            step[0] = (static_cast<double>(layout.max.x) - lo[0]) / quant_max;
+            step[1] = (static_cast<double>(layout.max.y) - lo[1]) / quant_max;
+            step[2] = (static_cast<double>(layout.max.z) - lo[2]) / quant_max;
+            for (std::size_t i = 0; i < b.count; ++i) {
+                const std::byte* p = in + i * stride;
+                mesh.vertices[b.first + i] = Vec3{dequantize(get<std::uint16_t>(p + 0), lo[0], step[0]),
+                                                  dequantize(get<std::uint16_t>(p + 2), lo[1], step[1]),
+                                                  dequantize(get<std::uint16_t>(p + 4), lo[2], step[2])};
+            }
+        } else {
+            for (std::size_t i = 0; i < b.count; ++i) {
+                const std::byte* p = in + i * stride;
+                mesh.vertices[b.first + i] = Vec3{get<float>(p + 0), get<float>(p + 4), get<float>(p + 8)};
+            }
+        }
+        return true;
+    case Stream::indices: {
+        std::uint32_t worst = 0;
+        for (std::size_t i = 0; i < b.count; ++i) {
+            auto& tri = mesh.indices[b.first + i];
+            for (std::size_t k = 0; k < 3; ++k) {
+                tri[k] = get<std::uint32_t>(in + i * stride + k * 4);
+                worst = std::max(worst, tri[k]);
+            }
+        }
+        return b.count == 0 || worst < layout.vertex_count;
+    }
+    case Stream::normals:
+        for (std::size_t i = 0; i < b.count; ++i) {
+            const std::byte* p = in + i * stride;
+            mesh.normals[b.first + i] = (layout.flags & oct)
+                ? oct_decode(get<std::int16_t>(p + 0), get<std::int16_t>(p + 2))
+                : Vec3{get<float>(p + 0), get<float>(p + 4), get<float>(p + 8)};
+        }
+        return true;
+    }
+    return false;
+}
+
+// ---- header ----------------------------------------------------------------
+
+struct Header {
+    Layout layout;
+    CacheInfo info;
+    std::string_view name;
+    std::size_t block_count = 0;
+    const std::byte* table = nullptr;
+};
+
+std::expected<Header, std::string> read_header(std::span<const std::byte> bytes) {
+    if (bytes.size() < header_size || std::memcmp(bytes.data(), magic, sizeof magic) != 0)
+        return cache_error("not a Harmony mesh cache");
+    const std::byte* h = bytes.data();
+    if (get<std::uint32_t>(h + 8) != version)
+        return cache_error(std::format("unsupported version {}", get<std::uint32_t>(h + 8)));
+
+    Header out;
+    Layout& l = out.layout;
+    l.flags = get<std::uint32_t>(h + 12);
+    if (l.flags & ~known_flags) return cache_error(std::format("unknown flags {:#x}", l.flags));
+    const std::uint64_t vertices = get<std::uint64_t>(h + 16);
+    const std::uint64_t faces = get<std::uint64_t>(h + 24);
+    l.min = Vec3{get<float>(h + 32), get<float>(h + 36), get<float>(h + 40)};
+    l.max = Vec3{get<float>(h + 44), get<float>(h + 48), get<float>(h + 52)};
+    l.block_items = get<std::uint32_t>(h + 80);
+    out.block_count = get<std::uint32_t>(h + 84);
+    const std::size_t name_size = get<std::uint32_t>(h + 88);
+
+    if (vertices > std::uint64_t{std::numeric_limits<std::uint32_t>::max()} + 1)
+        return cache_error("vertex count exceeds 32-bit indices");
+    if (faces > std::numeric_limits<std::uint32_t>::max() * std::uint64_t{256})
+        return cache_error(std::format("implausible face count {}", faces));
+    if (l.block_items == 0 || l.block_items > max_block_items)
+        return cache_error(std::format("invalid block size {}", l.block_items));
+    l.vertex_count = static_cast<std::size_t>(vertices);
+    l.face_count = static_cast<std::size_t>(faces);
+
+    const std::size_t rest = bytes.size() - header_size;
+    if (name_size > rest || out.block_count > (rest - name_size) / entry_size)
+        return cache_error("truncated header");
+    out.name = std::string_view(reinterpret_cast<const char*>(h + header_size), name_size);
+    out.table = h + header_size + name_size;
+
+    CacheInfo& info = out.info;
+    info.vertex_count = vertices;
+    info.face_count = faces;
+    info.min = l.min;
+    info.max = l.max;
+    info.quantized_positions = (l.flags & quantized) != 0;
+    info.has_normals = (l.flags & normals) != 0;
+    info.oct_normals = (l.flags & oct) != 0;
+    info.compute_missing_normals = (l.flags & filled_normals) != 0;
+    info.weld_epsilon = get<float>(h + 92);
+    info.source_size = get<std::uint64_t>(h + 56);
+    info.source_mtime = get<std::int64_t>(h + 64);
+    info.source_hash = get<std::uint64_t>(h + 72);
+    return out;
+}
+
+// ---- source keys -----------------------------------------------------------
+
+// Fast non-cryptographic 64-bit hash; four independent lanes keep the
+// multiplier busy
+std::uint64_t content_hash(std::span<const std::byte> bytes) noexcept {
+    constexpr std::uint64_t k = 0x9E3779B97F4A7C15ULL;
+    std::uint64_t lane[4] = {k, k ^ 1, k ^ 2, k ^ 3};
+    const std::byte* p = bytes.data();
+    std::size_t n = bytes.size();
+    for (; n >= 32; p += 32, n -= 32)
+        for (int i = 0; i < 4; ++i) {
+            lane[i] = (lane[i] ^ get<std::uint64_t>(p + i * 8)) * 0xff51afd7ed558ccdULL;
+            lane[i] = std::rotl(lane[i], 29);
+        }
+    std::uint64_t h = bytes.size();
+    for (std::uint64_t v : lane) h = (h ^ v) * k;
+    for (; n > 0; ++p, --n) h = (h ^ static_cast<std::uint64_t>(*p)) * 0x100000001B3ULL;
+    h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ULL; h ^= h >> 33;
+    return h;
+}
+
+std::int64_t mtime_ns(fs::file_time_type t) noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+}
+
+bool lossy(const CacheOptions& o) noexcept {
+    return o.weld_epsilon > 0.0f || o.quantize_positions || !o.store_normals || o.oct_normals;
+}
+
+// A cache built by load_cached() with `o` would have this header
+bool built_with(const CacheInfo& info, const CacheOptions& o) noexcept {
+    return info.quantized_positions == o.quantize_positions && info.has_normals == o.store_normals
+        && info.oct_normals == (o.store_normals && o.oct_normals) && info.weld_epsilon == o.weld_epsilon
+        && info.compute_missing_normals == o.parse.compute_missing_normals;
+}
+
+std::expected<void, std::string> write_file(const fs::path& path, std::span<const std::byte> bytes) {
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    if (!os) return std::unexpected(std::format("Cannot open '{}' for writing", path.string()));
+    if (!Binary::write_exact(os, bytes) || !os.flush())
+        return std::unexpected(std::format("I/O error while writing '{}'", path.string()));
+    return {};
+}
+
+} // namespace
+
+bool codec_available(CacheCodec codec) noexcept {
+    switch (codec) {
+    case CacheCodec::none: return true;
+#ifdef HARMONY_HAVE_LZ4
+    case CacheCodec::lz4: return true;
+#endif
+#ifdef HARMONY_HAVE_ZSTD
+    case CacheCodec::zstd: return true;
+#endif
+    default: return false;
+    }
+}
+
+std::expected<std::vector<std::byte>, std::string>
+encode_cache(const IndexedMesh& mesh, const CacheOptions& options, const CacheInfo& source) {
+    if (mesh.vertices.size() > std::uint64_t{std::numeric_limits<std::uint32_t>::max()} + 1)
+        return cache_error("more vertices than 32-bit indices address");
+    if (mesh.name.size() > std::numeric_limits<std::uint32_t>::max())
+        return cache_error("mesh name too long");
+    if (options.block_items == 0 || options.block_items > max_block_items)
+        return cache_error(std::format("block_items must be in [1, {}]", max_block_items));
+
+    Layout layout;
+    layout.vertex_count = mesh.vertices.size();
+    layout.face_count = mesh.indices.size();
+    layout.block_items = options.block_items;
+    const bool with_normals = options.store_normals && mesh.normals.size() == mesh.indices.size();
+    layout.flags = (options.quantize_positions ? quantized : 0u)
+                 | (with_normals ? normals : 0u)
+                 | (with_normals && options.oct_normals ? oct : 0u)
+                 | (options.parse.compute_missing_normals ? filled_normals : 0u);
+    if (!mesh.vertices.empty()) {
+        layout.min = layout.max = mesh.vertices.front();
+        for (const Vec3& p : mesh.vertices) {
+            layout.min = Vec3{std::min(layout.min.x, p.x), std::min(layout.min.y, p.y), std::min(layout.min.z, p.z)};
+            layout.max = Vec3{std::max(layout.max.x, p.x), std::max(layout.max.y, p.y), std::max(layout.max.z, p.z)};
+        }
+    }
+    for (const auto& tri : mesh.indices)
+        for (std::uint32_t i : tri)
+            if (i >= layout.vertex_count)
+                return cache_error(std::format("index {} out of range ({} vertices)", i, layout.vertex_count));
+
+    const std::vector<Block> blocks = plan_blocks(layout);
+    if (blocks.size() > std::numeric_limits<std::uint32_t>::max())
+        return cache_error("too many blocks");
+    const CacheCodec codec = codec_available(options.codec) ? options.codec : CacheCodec::none;
+
+    struct Encoded {
+        CacheCodec codec = CacheCodec::none;
+        std::vector<std::byte> data;
+    };
+    std::vector<Encoded> encoded(blocks.size());
+    detail::parallel_for(blocks.size(), options.threads, [&](std::size_t i) {
+        const Block& b = blocks[i];
+        std::vector<std::byte> raw(b.count * layout.stride(b.stream));
+        encode_items(mesh, layout, b, raw.data());
+        if (codec != CacheCodec::none) {
+            std::vector<std::byte> packed(compress_bound(codec, raw.size()));
+            // Incompressible blocks are stored as they are
+            if (const auto n = compress(codec, options.level, raw, packed); n && *n < raw.size()) {
+                packed.resize(*n);
+                encoded[i] = {codec, std::move(packed)};
+                return;
+            }
+        }
+        encoded[i] = {CacheCodec::none, std::move(raw)};
+    });
+
+    const std::size_t table = header_size + mesh.name.size();
+    std::size_t total = table + blocks.size() * entry_size;
+    for (const Encoded& e : encoded) total += e.data.size();
+
+    std::vector<std::byte> out(total);
+    std::byte* h = out.data();
+    std::memcpy(h, magic, sizeof magic);
+    put<std::uint32_t>(h + 8, version);
+    put<std::uint32_t>(h + 12, layout.flags);
+    put<std::uint64_t>(h + 16, layout.vertex_count);
+    put<std::uint64_t>(h + 24, layout.face_count);
+    put<float>(h + 32, layout.min.x);
+    put<float>(h + 36, layout.min.y);
+    put<float>(h + 40, layout.min.z);
+    put<float>(h + 44, layout.max.x);
+    put<float>(h + 48, layout.max.y);
+    put<float>(h + 52, layout.max.z);
+    put<std::uint64_t>(h + 56, source.source_size);
+    put<std::int64_t>(h + 64, source.source_mtime);
+    put<std::uint64_t>(h + 72, source.source_hash);
+    put<std::uint32_t>(h + 80, static_cast<std::uint32_t>(layout.block_items));
+    put<std::uint32_t>(h + 84, static_cast<std::uint32_t>(blocks.size()));
+    put<std::uint32_t>(h + 88, static_cast<std::uint32_t>(mesh.name.size()));
+    put<float>(h + 92, options.weld_epsilon);
+    std::memcpy(h + header_size, mesh.name.data(), mesh.name.size());
+
+    std::size_t offset = table + blocks.size() * entry_size;
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        std::byte* e = out.data() + table + i * entry_size;
+        put<std::uint8_t>(e + 0, static_cast<std::uint8_t>(blocks[i].stream));
+        put<std::uint8_t>(e + 1, static_cast<std::uint8_t>(encoded[i].codec));
+        put<std::uint32_t>(e + 4, static_cast<std::uint32_t>(encoded[i].data.size()));
+        put<std::uint64_t>(e + 8, offset);
+        std::memcpy(out.data() + offset, encoded[i].data.data(), encoded[i].data.size());
+        offset += encoded[i].data.size();
+    }
+    return out;
+}
+
+std::expected<CacheInfo, std::string> cache_info(std::span<const std::byte> bytes) {
+    auto header = read_header(bytes);
+    if (!header) return std::unexpected(std::move(header.error()));
+    return header->info;
+}
+
+std::expected<IndexedMesh, std::string> decode_cache(std::span<const std::byte> bytes, unsigned threads) {
+    auto header = read_header(bytes);
+    if (!header) return std::unexpected(std::move(header.error()));
+    const Layout& layout = header->layout;
+    const std::vector<Block> blocks = plan_blocks(layout);
+    if (blocks.size() != header->block_count)
+        return cache_error(std::format("{} blocks listed, {} expected", header->block_count, blocks.size()));
+
+    // Validate the table before allocating anything
+    struct Entry {
+        CacheCodec codec;
+        std::span<const std::byte> data;
+    };
+    std::vector<Entry> entries(blocks.size());
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        const std::byte* e = header->table + i * entry_size;
+        const auto stream = get<std::uint8_t>(e + 0);
+        const auto codec = static_cast<CacheCodec>(get<std::uint8_t>(e + 1));
+        const std::size_t size = get<std::uint32_t>(e + 4);
+        const std::uint64_t offset = get<std::uint64_t>(e + 8);
+        if (stream != static_cast<std::uint8_t>(blocks[i].stream))
+            return cache_error(std::format("block {} belongs to the wrong stream", i));
+        if (offset > bytes.size() || size > bytes.size() - offset)
+            return cache_error(std::format("block {} lies past the end of the file", i));
+        const std::size_t raw = blocks[i].count * layout.stride(blocks[i].stream);
+        if (codec != CacheCodec::none && !codec_available(codec))
+            return cache_error(std::format("block {} uses {}, which this build does not support", i,
+                                           codec_name(codec)));
+        // Stored blocks are exact and compressed ones cannot expand beyond
+        // the codec's limit, so the counts are bounded by the file size
+        if (codec == CacheCodec::none ? size != raw : size * max_expansion(codec) < raw)
+            return cache_error(std::format("block {} has {} bytes, too few for {} raw bytes", i, size, raw));
+        entries[i] = {codec, bytes.subspan(static_cast<std::size_t>(offset), size)};
+    }
+
+    IndexedMesh mesh;
+    try {
+        mesh.name.assign(header->name);
+        mesh.vertices.resize(layout.vertex_count);
+        mesh.indices.resize(layout.face_count);
+        if (layout.flags & normals) mesh.normals.resize(layout.face_count);
+    } catch (const std::bad_alloc&) {
+        return cache_error(std::format("out of memory for {} vertices and {} faces", layout.vertex_count,
+                                       layout.face_count));
+    }
+
+    std::vector<std::uint8_t> failed(blocks.size(), 0); // 1 = codec, 2 = index range
+    detail::parallel_for(blocks.size(), threads, [&](std::size_t i) {
+        const Block& b = blocks[i];
+        const Entry& e = entries[i];
+        const std::byte* data = e.data.data();
+        std::vector<std::byte> scratch;
+        if (e.codec != CacheCodec::none) {
+            scratch.resize(b.count * layout.stride(b.stream));
+            if (!decompress(e.codec, e.data, scratch)) {
+                failed[i] = 1;
+                return;
+            }
+            data = scratch.data();
+        }
+        if (!decode_items(data, layout, b, mesh)) failed[i] = 2;
+    });
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        if (failed[i] == 1) return cache_error(std::format("block {} is corrupt", i));
+        if (failed[i] == 2) return cache_error(std::format("block {} indexes past the vertices", i));
+    }
+    return mesh;
+}
+
+std::expected<void, std::string>
+save_cache(const fs::path& path, const IndexedMesh& mesh, const CacheOptions& options) {
+    auto bytes = encode_cache(mesh, options);
+    if (!bytes) return std::unexpected(std::move(bytes.error()));
+    return write_file(path, *bytes);
+}
+
+std::expected<void, std::string>
+save_cache(const fs::path& path, const Mesh& mesh, const CacheOptions& options) {
+    return save_cache(path, weld(mesh, options.weld_epsilon, options.store_normals), options);
+}
+
+std::expected<IndexedMesh, std::string> load_cache(const fs::path& path, unsigned threads) {
+    auto mapped = MappedFile::open(path);
+    if (!mapped) return std::unexpected(std::format("Mesh cache: {}", mapped.error()));
+    return decode_cache(mapped->bytes(), threads);
+}
+
+fs::path cache_path(const fs::path& source, const CacheOptions& options) {
+    if (!options.directory) {
+        fs::path p = source;
+        p += ".hmc";
+        return p;
+    }
+    // Same-named sources from different directories must not collide
+    std::error_code ec;
+    const std::string where = fs::absolute(source, ec).lexically_normal().string();
+    const std::uint64_t tag = content_hash(std::as_bytes(std::span(where.data(), where.size())));
+    fs::path name = source.filename();
+    name += std::format(".{:016x}.hmc", tag);
+    return *options.directory / name;
+}
+
+std::expected<Mesh, std::string> load_cached(const fs::path& source, const CacheOptions& options) {
+    std::error_code ec;
+    CacheInfo key;
+    key.source_size = fs::file_size(source, ec);
+    if (!ec) key.source_mtime = mtime_ns(fs::last_write_time(source, ec));
+    if (ec) return std::unexpected(std::format("STL: Cannot open '{}'", source.string()));
+
+    std::optional<MappedFile> mapped_source;
+    auto map_source = [&]() -> std::expected<void, std::string> {
+        if (mapped_source) return {};
+        auto m = MappedFile::open(source);
+        if (!m) return std::unexpected(std::format("STL: {}", m.error()));
+        mapped_source.emplace(std::move(*m));
+        return {};
+    };
+    if (options.verify_hash) {
+        if (auto ok = map_source(); !ok) return std::unexpected(std::move(ok.error()));
+        key.source_hash = content_hash(mapped_source->bytes());
+    }
+
+    const fs::path cache = cache_path(source, options);
+    {
+        auto mapped = MappedFile::open(cache);
+        std::expected<CacheInfo, std::string> info = std::unexpected(std::string());
+        if (mapped) info = cache_info(mapped->bytes());
+        if (info && info->source_size == key.source_size && info->source_mtime == key.source_mtime
+            && (!options.verify_hash || info->source_hash == key.source_hash) && built_with(*info, options)) {
+            if (auto mesh = decode_cache(mapped->bytes(), options.threads)) return expand(*mesh);
+        }
+        // Stale or damaged: rebuild below (the mapping is closed first)
+    }
+
+    if (auto ok = map_source(); !ok) return std::unexpected(std::move(ok.error()));
+    auto mesh = parse(mapped_source->view(), options.parse);
+    if (!mesh) return mesh;
+    if (!options.verify_hash) key.source_hash = content_hash(mapped_source->bytes());
+    mapped_source.reset();
+
+    auto bytes = encode_cache(weld(*mesh, options.weld_epsilon, options.store_normals), options, key);
+    if (!bytes) return mesh; // e.g. too many vertices: just skip caching
+    if (options.directory) fs::create_directories(*options.directory, ec);
+    // Write beside the target and rename, so readers never see a partial file
+    fs::path partial = cache;
+    partial += ".tmp";
+    if (write_file(partial, *bytes)) {
+        fs::rename(partial, cache, ec);
+        if (ec) fs::remove(partial, ec);
+    }
+
+    if (lossy(options))
+        if (auto decoded = decode_cache(*bytes, options.threads)) return expand(*decoded);
+    return mesh;
+}
+
+std::expected<CachedMesh, std::string>
+load_cached_with_bvh(const fs::path& source, const CacheOptions& options, const BVH::BuildOptions& bvh_options) {
+    auto mesh = load_cached(source, options);
+    if (!mesh) return std::unexpected(std::move(mesh.error()));
+
+    // The sidecar starts with the source's size and mtime, then BVH::encode()
+    constexpr std::size_t key_size = 16;
+    std::error_code ec;
+    const std::uint64_t size = fs::file_size(source, ec);
+    const std::int64_t mtime = ec ? 0 : mtime_ns(fs::last_write_time(source, ec));
+    fs::path sidecar = cache_path(source, options);
+    sidecar += ".bvh";
+
+    CachedMesh out{std::move(*mesh), {}};
+    if (!ec) {
+        if (auto mapped = MappedFile::open(sidecar); mapped && mapped->bytes().size() >= key_size) {
+            const auto bytes = mapped->bytes();
+            if (get<std::uint64_t>(bytes.data()) == size && get<std::int64_t>(bytes.data() + 8) == mtime) {
+                auto bvh = BVH::decode(bytes.subspan(key_size));
+                if (bvh && bvh->size() == out.mesh.tris.size()) {
+                    out.bvh = std::move(*bvh);
+                    return out;
+                }
+            }
+        }
+    }
+
+    out.bvh = BVH::build(out.mesh.tris, bvh_options);
+    if (ec) return out;
+    const std::vector<std::byte> image = out.bvh.encode();
+    std::vector<std::byte> bytes(key_size + image.size());
+    put<std::uint64_t>(bytes.data(), size);
+    put<std::int64_t>(bytes.data() + 8, mtime);
+    std::memcpy(bytes.data() + key_size, image.data(), image.size());
+    fs::path partial = sidecar;
+    partial += ".tmp";
+    if (write_file(partial, bytes)) {
+        fs::rename(partial, sidecar, ec);
+        if (ec) fs::remove(partial, ec);
+    }
+    return out;
+}
+
+} // namespace Harmony::STL
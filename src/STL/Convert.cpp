@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <format>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+#include "Harmony/STL/Convert.h"
+#include "Harmony/STL/Reader.h"
+#include "Harmony/STL/Writer.h"
+#include "Instrument.h"
+
+namespace Harmony::STL {
+
+namespace {
+
+constexpr std::size_t batch_triangles = 4096;
+
+} // namespace
+
+std::expected<std::size_t, std::string>
+convert(std::istream& in, std::ostream& out, Format to, const SerializeOptions& options) {
+    const detail::StatsScope scope("convert");
+    // The writer fills missing normals itself, exactly as serialize() does
+    auto reader = Reader::open(in, false);
+    if (!reader) return std::unexpected(std::move(reader.error()));
+
+    // The first batch is read before the writer opens: an ASCII name is
+    // only known once its 'solid' line has been scanned
+    std::vector<Triangle> batch(batch_triangles);
+    auto n = reader->next_batch(batch);
+    if (!n) return std::unexpected(std::move(n.error()));
+
+    auto writer = Writer::open(out, to, reader->name(), reader->expected_count(), options);
+    if (!writer) return std::unexpected(std::move(writer.error()));
+    while (*n != 0) {
+        if (auto ok = writer->write(std::span<const Triangle>(batch.data(), *n)); !ok)
+            return std::unexpected(std::move(ok.error()));
+        n = reader->next_batch(batch);
+        if (!n) return std::unexpected(std::move(n.error()));
+    }
+    if (auto ok = writer->finish(); !ok) return std::unexpected(std::move(ok.error()));
+    return writer->written();
+}
+
+std::expected<std::size_t, std::string>
+convert(const std::filesystem::path& input, const std::filesystem::path& output, Format to,
+        const SerializeOptions& options) {
+    std::error_code ec;
+    if (std::filesystem::equivalent(input, output, ec))
+        return std::unexpected(std::format("STL: '{}' is both input and output", input.string()));
+    std::ifstream in(input, std::ios::binary);
+    if (!in) return std::unexpected(std::format("STL: Cannot open '{}'", input.string()));
+    std::ofstream out(output, std::ios::binary | std::ios::trunc);
+    if (!out) return std::unexpected(std::format("STL: Cannot open '{}' for writing", output.string()));
+    return convert(in, out, to, options);
+}
+
+} // namespace Harmony::STL
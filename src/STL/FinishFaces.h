@@ -0,0 +1,39 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Internal: the pass over freshly decoded faces shared by the parsers and
+// the reader. Missing normals are filled and, when the caller asked for
+// GeometryStats, the faces are measured by the same kernel.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "Harmony/STL/Measure.h"
+#include "Harmony/STL/Normals.h"
+
+namespace Harmony::STL::detail {
+
+/// Merges the measurements into `*geometry` (if set); returns the normals filled
+inline std::size_t finish_faces(std::span<Triangle> tris, bool compute_missing_normals,
+                                GeometryStats* geometry) noexcept {
+    if (!geometry) return compute_missing_normals ? fill_missing_normals(tris) : 0;
+    std::size_t filled = 0;
+    geometry->merge(compute_missing_normals ? measure_and_fill_normals(tris, true, &filled) : measure(tris));
+    return filled;
+}
+
+inline std::size_t finish_faces(MeshSoA& mesh, bool compute_missing_normals, GeometryStats* geometry) noexcept {
+    if (!geometry) return compute_missing_normals ? fill_missing_normals(mesh) : 0;
+    std::size_t filled = 0;
+    geometry->merge(compute_missing_normals ? measure_and_fill_normals(mesh, true, &filled) : measure(mesh));
+    return filled;
+}
+
+} // namespace Harmony::STL::detail
@@ -0,0 +1,346 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "Harmony/STL/IndexedMesh.h"
+#include "Parallel.h"
+
+namespace Harmony::STL {
+
+namespace {
+
+struct Key {
+    std::int64_t x, y, z;
+    friend bool operator==(const Key&, const Key&) = default;
+};
+
+inline std::uint64_t mix(std::uint64_t h) noexcept {
+    // splitmix64 finaliser
+    h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27; h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+inline std::uint64_t hash(const Key& k) noexcept {
+    return mix(static_cast<std::uint64_t>(k.x) * 0x9E3779B97F4A7C15ULL
+             ^ static_cast<std::uint64_t>(k.y) * 0xC2B2AE3D27D4EB4FULL
+             ^ static_cast<std::uint64_t>(k.z) * 0x165667B19E3779F9ULL);
+}
+
+// Exact mode hashes the bit pattern (+0.0f folds -0 into +0)
+inline Key exact_key(const Vec3& p) noexcept {
+    return Key{ std::bit_cast<std::uint32_t>(p.x + 0.0f),
+                std::bit_cast<std::uint32_t>(p.y + 0.0f),
+                std::bit_cast<std::uint32_t>(p.z + 0.0f) };
+}
+
+inline std::int64_t cell(float v, double inv_eps) noexcept {
+    constexpr double lim = 9.0e18;
+    const double c = std::floor(static_cast<double>(v) * inv_eps + 0.5);
+    return static_cast<std::int64_t>(std::clamp(c, -lim, lim));
+}
+
+// Open-addressing (linear probing) map Key -> vertex index; keys live in a
+// parallel array so a slot is just a 32-bit index.
+class VertexTable {
+public:
+    explicit VertexTable(std::size_t expected) {
+        rehash(std::bit_ceil(std::max<std::size_t>(64, expected)));
+    }
+
+    // Returns the index of `key`, inserting `pos` as a new vertex if unseen
+    std::uint32_t insert(const Key& key, const Vec3& pos, std::vector<Vec3>& vertices) {
+        if ((keys_.size() + 1) * 10 > slots_.size() * 7) rehash(slots_.size() * 2);
+        std::size_t i = hash(key) & mask_;
+        for (;;) {
+            const std::uint32_t s = slots_[i];
+            if (s == empty) break;
+            if (keys_[s] == key) return s;
+            i = (i + 1) & mask_;
+        }
+        if (keys_.size() >= std::numeric_limits<std::uint32_t>::max())
+            throw std::length_error("weld: more than 2^32-1 unique vertices");
+        const auto idx = static_cast<std::uint32_t>(keys_.size());
+        slots_[i] = idx;
+        keys_.push_back(key);
+        vertices.push_back(pos);
+        return idx;
+    }
+
+private:
+    static constexpr std::uint32_t empty = std::numeric_limits<std::uint32_t>::max();
+
+    void rehash(std::size_t capacity) {
+        slots_.assign(capacity, empty);
+        mask_ = capacity - 1;
+        for (std::uint32_t k = 0; k < keys_.size(); ++k) {
+            std::size_t i = hash(keys_[k]) & mask_;
+            while (slots_[i] != empty) i = (i + 1) & mask_;
+            slots_[i] = k;
+        }
+    }
+
+    std::vector<std::uint32_t> slots_;
+    std::vector<Key> keys_;
+    std::size_t mask_ = 0;
+};
+
+constexpr std::size_t clean_chunk = std::size_t{1} << 16;
+
+inline std::size_t chunk_begin(std::size_t c, std::size_t chunks, std::size_t n) noexcept {
+    return n * c / chunks;
+}
+
+// rep[i] = the smallest j with eq(i, j), for every i < n. Items are
+// scattered by the top hash bits into partitions of ~16K, in index order,
+// and each partition is deduplicated with its own small open-addressing
+// table; so the first item of a class is seen first and becomes the rep.
+template <class Hash, class Eq>
+void find_reps(std::size_t n, unsigned threads, const Hash& hash_of, const Eq& eq,
+               std::vector<std::uint32_t>& rep) {
+    constexpr std::uint32_t empty = std::numeric_limits<std::uint32_t>::max();
+    rep.resize(n);
+    if (n == 0) return;
+    const int bits = std::min(12, static_cast<int>(std::bit_width(n >> 14)));
+    const std::size_t parts = std::size_t{1} << bits;
+    const std::size_t chunks = threads > 1 ? std::clamp<std::size_t>(n / clean_chunk, 1, threads * 4) : 1;
+    auto part_of = [&](std::uint64_t h) { return bits ? static_cast<std::size_t>(h >> (64 - bits)) : 0; };
+
+    // Per-chunk histograms, scanned partition-major so each partition
+    // receives its items in index order
+    std::vector<std::uint32_t> offset(chunks * parts, 0);
+    detail::parallel_for(chunks, threads, [&](std::size_t c) {
+        for (std::size_t i = chunk_begin(c, chunks, n), e = chunk_begin(c + 1, chunks, n); i < e; ++i)
+            ++offset[c * parts + part_of(hash_of(i))];
+    });
+    std::vector<std::size_t> start(parts + 1);
+    std::uint32_t sum = 0;
+    for (std::size_t p = 0; p < parts; ++p) {
+        start[p] = sum;
+        for (std::size_t c = 0; c < chunks; ++c) {
+            const std::uint32_t k = offset[c * parts + p];
+            offset[c * parts + p] = sum;
+            sum += k;
+        }
+    }
+    start[parts] = n;
+    std::vector<std::uint32_t> order(n);
+    detail::parallel_for(chunks, threads, [&](std::size_t c) {
+        for (std::size_t i = chunk_begin(c, chunks, n), e = chunk_begin(c + 1, chunks, n); i < e; ++i)
+            order[offset[c * parts + part_of(hash_of(i))]++] = static_cast<std::uint32_t>(i);
+    });
+
+    detail::parallel_for(parts, threads, [&](std::size_t p) {
+        const std::size_t b = start[p], e = start[p + 1];
+        if (b == e) return;
+        const std::size_t mask = std::bit_ceil(2 * (e - b)) - 1;
+        std::vector<std::uint32_t> slots(mask + 1, empty);
+        for (std::size_t k = b; k < e; ++k) {
+            const std::uint32_t i = order[k];
+            std::size_t s = hash_of(i) & mask;
+            for (;; s = (s + 1) & mask) {
+                if (slots[s] == empty) { slots[s] = rep[i] = i; break; }
+                if (eq(slots[s], i)) { rep[i] = slots[s]; break; }
+            }
+        }
+    });
+}
+
+// Face vertex triple in a canonical order: rotated to start at the
+// smallest index (winding kept) or fully sorted
+inline std::array<std::uint32_t, 3> canonical(std::array<std::uint32_t, 3> f, bool winding) noexcept {
+    if (winding) {
+        const std::size_t m = f[1] < f[0] ? (f[2] < f[1] ? 2 : 1) : (f[2] < f[0] ? 2 : 0);
+        std::rotate(f.begin(), f.begin() + static_cast<std::ptrdiff_t>(m), f.end());
+    } else {
+        std::sort(f.begin(), f.end());
+    }
+    return f;
+}
+
+} // namespace
+
+IndexedMesh weld(const Mesh& mesh, float epsilon, bool keep_normals) {
+    IndexedMesh out;
+    out.name = mesh.name;
+    out.indices.resize(mesh.tris.size());
+    // Closed meshes have about half as many vertices as faces
+    out.vertices.reserve(mesh.tris.size() / 2 + 3);
+    if (keep_normals) out.normals.reserve(mesh.tris.size());
+
+    VertexTable table(mesh.tris.size());
+    const bool snap = epsilon > 0.0f;
+    const double inv_eps = snap ? 1.0 / static_cast<double>(epsilon) : 0.0;
+
+    for (std::size_t f = 0; f < mesh.tris.size(); ++f) {
+        const Triangle& t = mesh.tris[f];
+        for (std::size_t k = 0; k < 3; ++k) {
+            const Vec3& p = t.v[k];
+            const Key key = snap ? Key{cell(p.x, inv_eps), cell(p.y, inv_eps), cell(p.z, inv_eps)}
+                                 : exact_key(p);
+            out.indices[f][k] = table.insert(key, p, out.vertices);
+        }
+        if (keep_normals) out.normals.push_back(t.normal);
+    }
+    return out;
+}
+
+IndexedMesh clean(const Mesh& mesh, const CleanupOptions& options, CleanupStats* stats) {
+    const std::size_t faces = mesh.tris.size();
+    const std::size_t corners = faces * 3;
+    if (corners >= std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("clean: more than 2^32-1 corners");
+    const unsigned threads = detail::resolve_threads(options.threads);
+    const bool snap = options.weld_epsilon > 0.0f;
+    const double inv_eps = snap ? 1.0 / static_cast<double>(options.weld_epsilon) : 0.0;
+    auto corner = [&](std::size_t c) -> const Vec3& { return mesh.tris[c / 3].v[c % 3]; };
+    auto key_of = [&](std::size_t c) {
+        const Vec3& p = corner(c);
+        return snap ? Key{cell(p.x, inv_eps), cell(p.y, inv_eps), cell(p.z, inv_eps)} : exact_key(p);
+    };
+    const std::size_t chunks = threads > 1 ? std::clamp<std::size_t>(corners / clean_chunk, 1, threads * 4) : 1;
+
+    IndexedMesh out;
+    out.name = mesh.name;
+
+    // Weld: every corner's rep is the first corner in its cell, and reps
+    // are numbered in corner order
+    std::vector<std::uint32_t> rep;
+    find_reps(corners, threads, [&](std::size_t c) { return hash(key_of(c)); },
+              [&](std::size_t a, std::size_t b) { return key_of(a) == key_of(b); }, rep);
+    std::vector<std::uint32_t> vid(corners);
+    std::vector<std::uint32_t> first(chunks + 1, 0);
+    detail::parallel_for(chunks, threads, [&](std::size_t c) {
+        for (std::size_t i = chunk_begin(c, chunks, corners), e = chunk_begin(c + 1, chunks, corners); i < e; ++i)
+            first[c + 1] += rep[i] == i;
+    });
+    for (std::size_t c = 0; c < chunks; ++c) first[c + 1] += first[c];
+    out.vertices.resize(first[chunks]);
+    detail::parallel_for(chunks, threads, [&](std::size_t c) {
+        std::uint32_t next = first[c];
+        for (std::size_t i = chunk_begin(c, chunks, corners), e = chunk_begin(c + 1, chunks, corners); i < e; ++i)
+            if (rep[i] == i) {
+                out.vertices[next] = corner(i);
+                vid[i] = next++;
+            }
+    });
+    detail::parallel_for(chunks, threads, [&](std::size_t c) {
+        for (std::size_t i = chunk_begin(c, chunks, corners), e = chunk_begin(c + 1, chunks, corners); i < e; ++i)
+            // rep[i] < i and reps were numbered above; reps themselves are
+            // left alone, as other chunks read them
+            if (rep[i] != i) vid[i] = vid[rep[i]];
+    });
+    rep = {};
+    auto face = [&](std::size_t f) {
+        return std::array<std::uint32_t, 3>{vid[3 * f], vid[3 * f + 1], vid[3 * f + 2]};
+    };
+
+    // Degenerate faces, then duplicates among the rest
+    std::vector<std::uint8_t> keep(faces, 1);
+    if (options.remove_degenerate)
+        detail::parallel_for(chunks, threads, [&](std::size_t c) {
+            for (std::size_t f = chunk_begin(c, chunks, faces), e = chunk_begin(c + 1, chunks, faces); f < e; ++f) {
+                const auto i = face(f);
+                if (i[0] == i[1] || i[1] == i[2] || i[0] == i[2]) { keep[f] = 0; continue; }
+                const Vec3 &a = out.vertices[i[0]], &b = out.vertices[i[1]], &d = out.vertices[i[2]];
+                const float ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+                const float vx = d.x - a.x, vy = d.y - a.y, vz = d.z - a.z;
+                const float cx = uy * vz - uz * vy, cy = uz * vx - ux * vz, cz = ux * vy - uy * vx;
+                const float area = 0.5f * std::sqrt(cx * cx + cy * cy + cz * cz);
+                if (!(area > options.min_area)) keep[f] = 0;
+            }
+        });
+    std::size_t degenerate = 0;
+    for (const std::uint8_t k : keep) degenerate += k == 0;
+
+    std::size_t duplicates = 0;
+    if (options.remove_duplicates) {
+        const bool winding = options.respect_winding;
+        auto face_hash = [&](std::size_t f) {
+            const auto k = canonical(face(f), winding);
+            return mix((std::uint64_t{k[0]} << 32 | k[1]) * 0x9E3779B97F4A7C15ULL ^ k[2]);
+        };
+        auto same_face = [&](std::size_t a, std::size_t b) {
+            return keep[a] == keep[b] && canonical(face(a), winding) == canonical(face(b), winding);
+        };
+        std::vector<std::uint32_t> face_rep;
+        find_reps(faces, threads, face_hash, same_face, face_rep);
+        for (std::size_t f = 0; f < faces; ++f)
+            if (keep[f] && face_rep[f] != f) {
+                keep[f] = 0;
+                ++duplicates;
+            }
+    }
+
+    // Compact faces in order, then drop vertices no surviving face uses
+    std::vector<std::uint32_t> kept(chunks + 1, 0);
+    detail::parallel_for(chunks, threads, [&](std::size_t c) {
+        for (std::size_t f = chunk_begin(c, chunks, faces), e = chunk_begin(c + 1, chunks, faces); f < e; ++f)
+            kept[c + 1] += keep[f];
+    });
+    for (std::size_t c = 0; c < chunks; ++c) kept[c + 1] += kept[c];
+    out.indices.resize(kept[chunks]);
+    if (options.keep_normals) out.normals.resize(kept[chunks]);
+    std::vector<std::uint8_t> used(out.vertices.size(), 0);
+    detail::parallel_for(chunks, threads, [&](std::size_t c) {
+        std::uint32_t next = kept[c];
+        for (std::size_t f = chunk_begin(c, chunks, faces), e = chunk_begin(c + 1, chunks, faces); f < e; ++f) {
+            if (!keep[f]) continue;
+            out.indices[next] = face(f);
+            if (options.keep_normals) out.normals[next] = mesh.tris[f].normal;
+            for (const std::uint32_t v : out.indices[next])
+                std::atomic_ref<std::uint8_t>(used[v]).store(1, std::memory_order_relaxed);
+            ++next;
+        }
+    });
+
+    std::size_t unused = 0;
+    if (degenerate + duplicates > 0) {
+        std::vector<std::uint32_t> remap(out.vertices.size());
+        std::uint32_t next = 0;
+        for (std::size_t v = 0; v < out.vertices.size(); ++v) {
+            remap[v] = next;
+            if (used[v]) out.vertices[next++] = out.vertices[v];
+        }
+        unused = out.vertices.size() - next;
+        out.vertices.resize(next);
+        if (unused)
+            detail::parallel_for(chunks, threads, [&](std::size_t c) {
+                for (std::size_t f = chunk_begin(c, chunks, out.indices.size()),
+                     e = chunk_begin(c + 1, chunks, out.indices.size()); f < e; ++f)
+                    for (std::uint32_t& v : out.indices[f]) v = remap[v];
+            });
+    }
+
+    if (stats) *stats = CleanupStats{degenerate, duplicates, unused};
+    return out;
+}
+
+Mesh expand(const IndexedMesh& mesh) {
+    Mesh out;
+    out.name = mesh.name;
+    out.tris.resize(mesh.indices.size());
+    const bool have_normals = mesh.normals.size() == mesh.indices.size();
+    for (std::size_t f = 0; f < mesh.indices.size(); ++f) {
+        Triangle& t = out.tris[f];
+        for (std::size_t k = 0; k < 3; ++k) t.v[k] = mesh.vertices[mesh.indices[f][k]];
+        t.normal = have_normals ? mesh.normals[f] : face_normal(t);
+    }
+    return out;
+}
+
+} // namespace Harmony::STL
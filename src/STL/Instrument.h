@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Internal: instrumentation points behind Harmony/STL/Stats.h. Without
+// HARMONY_ENABLE_STATS the types are empty and every call inlines away.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "Harmony/STL/Stats.h"
+
+namespace Harmony::STL::detail {
+
+#if HARMONY_ENABLE_STATS
+
+/// Collector of the calling thread
+inline thread_local Stats thread_stats;
+
+/// Add to a counter of the current operation
+inline void count(std::uint64_t Stats::*field, std::uint64_t n = 1) noexcept { thread_stats.*field += n; }
+
+/// Brackets a public entry point; nested entry points (a detecting parse
+/// calling ASCII::parse) fold into the outermost one
+class StatsScope {
+public:
+    explicit StatsScope(const char* operation) noexcept;
+    ~StatsScope();
+    StatsScope(const StatsScope&) = delete;
+    StatsScope& operator=(const StatsScope&) = delete;
+
+private:
+    const char* operation_;
+    std::chrono::steady_clock::time_point start_;
+    bool outermost_;
+};
+
+/// Adds the lifetime of the object to one phase timer
+class PhaseTimer {
+public:
+    explicit PhaseTimer(std::chrono::nanoseconds Stats::*phase) noexcept
+        : phase_(phase), start_(std::chrono::steady_clock::now()) {}
+    ~PhaseTimer() { thread_stats.*phase_ += std::chrono::steady_clock::now() - start_; }
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    std::chrono::nanoseconds Stats::*phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#else
+
+inline void count(std::uint64_t Stats::*, std::uint64_t = 1) noexcept {}
+
+class StatsScope {
+public:
+    explicit StatsScope(const char*) noexcept {}
+};
+
+class PhaseTimer {
+public:
+    explicit PhaseTimer(std::chrono::nanoseconds Stats::*) noexcept {}
+};
+
+#endif
+
+/// Count a reallocation if pushing one more element into `v` will grow it
+template <class Vector>
+inline void count_growth(const Vector& v) noexcept {
+    if constexpr (stats_enabled)
+        if (v.size() == v.capacity()) count(&Stats::reallocations);
+}
+
+} // namespace Harmony::STL::detail
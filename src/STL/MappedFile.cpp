@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <utility>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <cstring>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "Harmony/STL/MappedFile.h"
+
+namespace Harmony::STL {
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0))
+#ifdef _WIN32
+    , file_(std::exchange(other.file_, nullptr))
+    , mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+        file_ = std::exchange(other.file_, nullptr);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+
+std::expected<MappedFile, std::string> MappedFile::open(const std::filesystem::path& path) {
+    MappedFile mf;
+    HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return std::unexpected(std::format("Cannot open '{}' (error {})", path.string(), ::GetLastError()));
+    }
+    mf.file_ = file;
+
+    LARGE_INTEGER size{};
+    if (!::GetFileSizeEx(file, &size)) {
+        return std::unexpected(std::format("Cannot stat '{}' (error {})", path.string(), ::GetLastError()));
+    }
+    if (size.QuadPart == 0) return mf;
+    if (static_cast<std::uintmax_t>(size.QuadPart) > std::numeric_limits<std::size_t>::max())
+        return std::unexpected(std::format("Cannot map '{}': too large for the address space", path.string()));
+
+    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        return std::unexpected(std::format("Cannot map '{}' (error {})", path.string(), ::GetLastError()));
+    }
+    mf.mapping_ = mapping;
+
+    void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        return std::unexpected(std::format("Cannot map '{}' (error {})", path.string(), ::GetLastError()));
+    }
+    mf.data_ = static_cast<const std::byte*>(view);
+    mf.size_ = static_cast<std::size_t>(size.QuadPart);
+    return mf;
+}
+
+void MappedFile::close() noexcept {
+    if (data_) ::UnmapViewOfFile(data_);
+    if (mapping_) ::CloseHandle(mapping_);
+    if (file_) ::CloseHandle(file_);
+    data_ = nullptr;
+    size_ = 0;
+    mapping_ = nullptr;
+    file_ = nullptr;
+}
+
+#else
+
+std::expected<MappedFile, std::string> MappedFile::open(const std::filesystem::path& path) {
+    MappedFile mf;
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return std::unexpected(std::format("Cannot open '{}': {}", path.string(), std::strerror(errno)));
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        const int err = errno;
+        ::close(fd);
+        return std::unexpected(std::format("Cannot stat '{}': {}", path.string(), std::strerror(err)));
+    }
+    if (st.st_size == 0) {
+        ::close(fd);
+        return mf;
+    }
+
+    if (static_cast<std::uintmax_t>(st.st_size) > std::numeric_limits<std::size_t>::max()) {
+        ::close(fd);
+        return std::unexpected(std::format("Cannot map '{}': too large for the address space", path.string()));
+    }
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    const int err = errno;
+    ::close(fd); // the mapping keeps the file referenced
+    if (addr == MAP_FAILED) {
+        return std::unexpected(std::format("Cannot map '{}': {}", path.string(), std::strerror(err)));
+    }
+    // Records are decoded front to back; let the kernel read ahead aggressively.
+    ::madvise(addr, size, MADV_SEQUENTIAL);
+
+    mf.data_ = static_cast<const std::byte*>(addr);
+    mf.size_ = size;
+    return mf;
+}
+
+void MappedFile::close() noexcept {
+    if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+} // namespace Harmony::STL
@@ -0,0 +1,29 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include "Harmony/STL/MeshSoA.h"
+
+namespace Harmony::STL {
+
+MeshSoA to_soa(const Mesh& mesh) {
+    MeshSoA out;
+    out.name = mesh.name;
+    out.resize(mesh.tris.size());
+    for (std::size_t i = 0; i < mesh.tris.size(); ++i) out.set(i, mesh.tris[i]);
+    return out;
+}
+
+Mesh to_mesh(const MeshSoA& mesh) {
+    Mesh out;
+    out.name = mesh.name;
+    out.tris.resize(mesh.size());
+    for (std::size_t i = 0; i < mesh.size(); ++i) out.tris[i] = mesh[i];
+    return out;
+}
+
+} // namespace Harmony::STL
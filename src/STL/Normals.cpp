@@ -0,0 +1,297 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <cmath>
+#include <limits>
+
+#if defined(HARMONY_X86_KERNELS)
+    #include <emmintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #include <immintrin.h>
+    #endif
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #include <arm_neon.h>
+#endif
+
+#include "Harmony/STL/Measure.h"
+#include "Harmony/STL/Normals.h"
+#include "NormalsKernel.h"
+
+namespace Harmony::STL {
+
+namespace detail {
+
+std::size_t normals_scalar(const NormalJob& job, bool only_missing) noexcept {
+    std::size_t filled = 0;
+    for (std::size_t i = 0; i < job.count; ++i)
+        filled += normal_one(job, i, only_missing, [](float x) noexcept { return std::sqrt(x); }) ? 1 : 0;
+    return filled;
+}
+
+void measure_scalar(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept {
+    for (std::size_t i = 0; i < job.count; ++i)
+        measure_one(job, i, mode, sums, [](float x) noexcept { return std::sqrt(x); });
+}
+
+#if defined(HARMONY_X86_KERNELS)
+
+namespace {
+
+struct Sse2Ops {
+    using reg = __m128;
+    static constexpr std::size_t width = 4;
+
+    static reg load(const float* p, std::size_t i, std::size_t s) noexcept {
+        if (s == 1) return _mm_loadu_ps(p + i);
+        const float* q = p + i * s;
+        return _mm_setr_ps(q[0], q[s], q[2 * s], q[3 * s]);
+    }
+    static void store(float* p, std::size_t i, std::size_t s, reg v, unsigned lanes) noexcept {
+        if (s == 1 && lanes == 0xFu) { _mm_storeu_ps(p + i, v); return; }
+        alignas(16) float tmp[4];
+        _mm_store_ps(tmp, v);
+        for (std::size_t k = 0; k < 4; ++k)
+            if (lanes >> k & 1u) p[(i + k) * s] = tmp[k];
+    }
+    static reg set1(float x) noexcept { return _mm_set1_ps(x); }
+    static reg add(reg a, reg b) noexcept { return _mm_add_ps(a, b); }
+    static reg sub(reg a, reg b) noexcept { return _mm_sub_ps(a, b); }
+    static reg mul(reg a, reg b) noexcept { return _mm_mul_ps(a, b); }
+    static reg div(reg a, reg b) noexcept { return _mm_div_ps(a, b); }
+    static reg sqrt(reg a) noexcept { return _mm_sqrt_ps(a); }
+    static reg abs(reg a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    // a < b ? a : b and a > b ? a : b, so a NaN `a` keeps `b`
+    static reg min(reg a, reg b) noexcept { return _mm_min_ps(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm_max_ps(a, b); }
+    static unsigned lt_mask(reg a, reg b) noexcept {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_cmplt_ps(a, b)));
+    }
+    // a > b ? x : y
+    static reg select_gt(reg a, reg b, reg x, reg y) noexcept {
+        const reg m = _mm_cmpgt_ps(a, b);
+        return _mm_or_ps(_mm_and_ps(m, x), _mm_andnot_ps(m, y));
+    }
+    static float sqrt_scalar(float x) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x))); }
+};
+
+} // namespace
+
+std::size_t normals_sse2(const NormalJob& job, bool only_missing) noexcept {
+    return normals_simd<Sse2Ops>(job, only_missing);
+}
+
+void measure_sse2(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept {
+    measure_simd<Sse2Ops>(job, mode, sums);
+}
+
+#endif // HARMONY_X86_KERNELS
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+
+namespace {
+
+struct NeonOps {
+    using reg = float32x4_t;
+    static constexpr std::size_t width = 4;
+
+    static reg load(const float* p, std::size_t i, std::size_t s) noexcept {
+        if (s == 1) return vld1q_f32(p + i);
+        const float* q = p + i * s;
+        const float tmp[4] = {q[0], q[s], q[2 * s], q[3 * s]};
+        return vld1q_f32(tmp);
+    }
+    static void store(float* p, std::size_t i, std::size_t s, reg v, unsigned lanes) noexcept {
+        if (s == 1 && lanes == 0xFu) { vst1q_f32(p + i, v); return; }
+        float tmp[4];
+        vst1q_f32(tmp, v);
+        for (std::size_t k = 0; k < 4; ++k)
+            if (lanes >> k & 1u) p[(i + k) * s] = tmp[k];
+    }
+    static reg set1(float x) noexcept { return vdupq_n_f32(x); }
+    static reg add(reg a, reg b) noexcept { return vaddq_f32(a, b); }
+    static reg sub(reg a, reg b) noexcept { return vsubq_f32(a, b); }
+    static reg mul(reg a, reg b) noexcept { return vmulq_f32(a, b); }
+    static reg div(reg a, reg b) noexcept { return vdivq_f32(a, b); }
+    static reg sqrt(reg a) noexcept { return vsqrtq_f32(a); }
+    static reg abs(reg a) noexcept { return vabsq_f32(a); }
+    // a < b ? a : b and a > b ? a : b, so a NaN `a` keeps `b` (unlike vminq)
+    static reg min(reg a, reg b) noexcept { return vbslq_f32(vcltq_f32(a, b), a, b); }
+    static reg max(reg a, reg b) noexcept { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+    static unsigned lt_mask(reg a, reg b) noexcept {
+        const uint32x4_t m = vcltq_f32(a, b);
+        return (vgetq_lane_u32(m, 0) & 1u) | (vgetq_lane_u32(m, 1) & 2u)
+             | (vgetq_lane_u32(m, 2) & 4u) | (vgetq_lane_u32(m, 3) & 8u);
+    }
+    // a > b ? x : y
+    static reg select_gt(reg a, reg b, reg x, reg y) noexcept { return vbslq_f32(vcgtq_f32(a, b), x, y); }
+    static float sqrt_scalar(float x) noexcept { return std::sqrt(x); }
+};
+
+} // namespace
+
+std::size_t normals_neon(const NormalJob& job, bool only_missing) noexcept {
+    return normals_simd<NeonOps>(job, only_missing);
+}
+
+void measure_neon(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept {
+    measure_simd<NeonOps>(job, mode, sums);
+}
+
+#endif
+
+} // namespace detail
+
+namespace {
+
+struct Selected {
+    detail::NormalKernel fn;
+    detail::MeasureKernel measure;
+    std::string_view name;
+};
+
+#if defined(HARMONY_X86_KERNELS)
+#if defined(_MSC_VER) && !defined(__clang__)
+// XCR0 must enable the register state, not just CPUID advertise the ISA
+bool os_saves(unsigned long long features) {
+    int r[4];
+    __cpuid(r, 1);
+    const bool osxsave = (r[2] & (1 << 27)) != 0;
+    return osxsave && (_xgetbv(0) & features) == features;
+}
+bool cpu_has_avx2() {
+    int r[4];
+    __cpuid(r, 0);
+    if (r[0] < 7 || !os_saves(0x6)) return false;
+    __cpuidex(r, 7, 0);
+    return (r[1] & (1 << 5)) != 0;
+}
+bool cpu_has_avx512f() {
+    int r[4];
+    __cpuid(r, 0);
+    if (r[0] < 7 || !os_saves(0xE6)) return false;
+    __cpuidex(r, 7, 0);
+    return (r[1] & (1 << 16)) != 0;
+}
+#else
+bool cpu_has_avx2() { __builtin_cpu_init(); return __builtin_cpu_supports("avx2"); }
+bool cpu_has_avx512f() { __builtin_cpu_init(); return __builtin_cpu_supports("avx512f"); }
+#endif
+#endif
+
+Selected select_kernel() noexcept {
+#if defined(HARMONY_X86_KERNELS)
+    if (cpu_has_avx512f()) return {detail::normals_avx512, detail::measure_avx512, "avx512"};
+    if (cpu_has_avx2()) return {detail::normals_avx2, detail::measure_avx2, "avx2"};
+    return {detail::normals_sse2, detail::measure_sse2, "sse2"};
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    return {detail::normals_neon, detail::measure_neon, "neon"};
+#else
+    return {detail::normals_scalar, detail::measure_scalar, "scalar"};
+#endif
+}
+
+const Selected& kernel() noexcept {
+    static const Selected selected = select_kernel();
+    return selected;
+}
+
+detail::NormalJob job_for(std::span<Triangle> tris) noexcept {
+    // Triangle is 12 packed floats: normal, v0, v1, v2
+    float* base = reinterpret_cast<float*>(tris.data());
+    detail::NormalJob job{};
+    for (std::size_t s = 0; s < 3; ++s)
+        for (std::size_t k = 0; k < 3; ++k) job.v[s][k] = base + 3 + s * 3 + k;
+    for (std::size_t k = 0; k < 3; ++k) job.n[k] = base + k;
+    job.stride = 12;
+    job.count = tris.size();
+    return job;
+}
+
+detail::NormalJob job_for(MeshSoA& mesh) noexcept {
+    detail::NormalJob job{};
+    for (std::size_t s = 0; s < 3; ++s) {
+        job.v[s][0] = mesh.v[s].x.data();
+        job.v[s][1] = mesh.v[s].y.data();
+        job.v[s][2] = mesh.v[s].z.data();
+    }
+    job.n[0] = mesh.normal.x.data();
+    job.n[1] = mesh.normal.y.data();
+    job.n[2] = mesh.normal.z.data();
+    job.stride = 1;
+    job.count = mesh.size();
+    return job;
+}
+
+GeometryStats run_measure(const detail::NormalJob& job, detail::NormalMode mode, std::size_t* filled) noexcept {
+    detail::MeasureSums sums;
+    for (std::size_t k = 0; k < 3; ++k) {
+        sums.lo[k] = std::numeric_limits<float>::infinity();
+        sums.hi[k] = -std::numeric_limits<float>::infinity();
+    }
+    if (job.count) kernel().measure(job, mode, sums);
+    if (filled) *filled = sums.filled;
+
+    GeometryStats stats;
+    stats.faces = job.count;
+    stats.degenerate = sums.degenerate;
+    stats.min = Vec3{sums.lo[0], sums.lo[1], sums.lo[2]};
+    stats.max = Vec3{sums.hi[0], sums.hi[1], sums.hi[2]};
+    stats.area = sums.area2 * 0.5;
+    stats.volume = sums.volume6 / 6.0;
+    return stats;
+}
+
+detail::NormalMode fill_mode(bool only_missing) noexcept {
+    return only_missing ? detail::NormalMode::missing : detail::NormalMode::all;
+}
+
+} // namespace
+
+static_assert(sizeof(Triangle) == 12 * sizeof(float), "Triangle must be 12 packed floats");
+
+void recompute_normals(std::span<Triangle> tris) noexcept {
+    if (!tris.empty()) kernel().fn(job_for(tris), false);
+}
+
+void recompute_normals(MeshSoA& mesh) noexcept {
+    if (!mesh.empty()) kernel().fn(job_for(mesh), false);
+}
+
+std::size_t fill_missing_normals(std::span<Triangle> tris) noexcept {
+    return tris.empty() ? 0 : kernel().fn(job_for(tris), true);
+}
+
+std::size_t fill_missing_normals(MeshSoA& mesh) noexcept {
+    return mesh.empty() ? 0 : kernel().fn(job_for(mesh), true);
+}
+
+// The keep mode never writes through the job's normal pointers
+GeometryStats measure(std::span<const Triangle> tris) noexcept {
+    return run_measure(job_for(std::span<Triangle>(const_cast<Triangle*>(tris.data()), tris.size())),
+                       detail::NormalMode::keep, nullptr);
+}
+
+GeometryStats measure(const MeshSoA& mesh) noexcept {
+    return run_measure(job_for(const_cast<MeshSoA&>(mesh)), detail::NormalMode::keep, nullptr);
+}
+
+GeometryStats measure_and_fill_normals(std::span<Triangle> tris, bool only_missing, std::size_t* filled) noexcept {
+    return run_measure(job_for(tris), fill_mode(only_missing), filled);
+}
+
+GeometryStats measure_and_fill_normals(MeshSoA& mesh, bool only_missing, std::size_t* filled) noexcept {
+    return run_measure(job_for(mesh), fill_mode(only_missing), filled);
+}
+
+std::string_view normals_kernel() noexcept {
+    return kernel().name;
+}
+
+} // namespace Harmony::STL
@@ -0,0 +1,248 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Internal: ISA-independent body of the batch normal kernels. Included by
+// translation units compiled with different -m flags, so everything here
+// has internal linkage and touches nothing but raw float pointers (no
+// inline library code may be emitted with wider instructions).
+
+#pragma once
+
+#include <cstddef>
+
+namespace Harmony::STL::detail {
+
+/// Component k of vertex slot s of face i is v[s][k][i * stride];
+/// normal component k is n[k][i * stride]. stride is 12 for Triangle, 1 for SoA.
+struct NormalJob {
+    const float* v[3][3];
+    float* n[3];
+    std::size_t stride;
+    std::size_t count;
+};
+
+using NormalKernel = std::size_t (*)(const NormalJob& job, bool only_missing) noexcept;
+
+/// What a measuring pass does with the normals it gets for free
+enum class NormalMode { keep, missing, all };
+
+/// Running sums of a measuring pass; lo/hi are set by the caller (they
+/// carry over between calls) and NaN coordinates never replace them
+struct MeasureSums {
+    double area2 = 0.0;   // sum of |e1 x e2|, twice the area
+    double volume6 = 0.0; // sum of v0 . (e1 x e2), six times the signed volume
+    float lo[3], hi[3];
+    std::size_t degenerate = 0; // faces with |e1 x e2| not > 0
+    std::size_t filled = 0;     // normals written
+};
+
+using MeasureKernel = void (*)(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept;
+
+std::size_t normals_scalar(const NormalJob& job, bool only_missing) noexcept;
+void measure_scalar(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept;
+#if defined(HARMONY_X86_KERNELS)
+std::size_t normals_sse2(const NormalJob& job, bool only_missing) noexcept;
+std::size_t normals_avx2(const NormalJob& job, bool only_missing) noexcept;
+std::size_t normals_avx512(const NormalJob& job, bool only_missing) noexcept;
+void measure_sse2(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept;
+void measure_avx2(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept;
+void measure_avx512(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept;
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+std::size_t normals_neon(const NormalJob& job, bool only_missing) noexcept;
+void measure_neon(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept;
+#endif
+
+namespace {
+
+inline float abs_f(float x) noexcept { return x < 0.0f ? -x : x; }
+
+inline unsigned popcount_bits(unsigned x) noexcept {
+    unsigned c = 0;
+    for (; x; x &= x - 1) ++c;
+    return c;
+}
+
+// Same operation order as face_normal(); sqrt comes from the caller so the
+// scalar tail in every ISA uses its own correctly rounded instruction.
+template <class Sqrt>
+inline bool normal_one(const NormalJob& job, std::size_t i, bool only_missing, Sqrt sqrt_f) noexcept {
+    const std::size_t o = i * job.stride;
+    float nx = job.n[0][o], ny = job.n[1][o], nz = job.n[2][o];
+    if (only_missing && !(abs_f(nx) + abs_f(ny) + abs_f(nz) < 1e-20f)) return false;
+
+    const float ax = job.v[0][0][o], ay = job.v[0][1][o], az = job.v[0][2][o];
+    const float e1x = job.v[1][0][o] - ax, e1y = job.v[1][1][o] - ay, e1z = job.v[1][2][o] - az;
+    const float e2x = job.v[2][0][o] - ax, e2y = job.v[2][1][o] - ay, e2z = job.v[2][2][o] - az;
+    nx = e1y * e2z - e1z * e2y;
+    ny = e1z * e2x - e1x * e2z;
+    nz = e1x * e2y - e1y * e2x;
+    const float len = sqrt_f(nx * nx + ny * ny + nz * nz);
+    if (len > 0.0f) { nx /= len; ny /= len; nz /= len; }
+    job.n[0][o] = nx; job.n[1][o] = ny; job.n[2][o] = nz;
+    return true;
+}
+
+/// Generic SIMD loop; Ops supplies the register type and primitive operations.
+template <class Ops>
+inline std::size_t normals_simd(const NormalJob& job, bool only_missing) noexcept {
+    using R = typename Ops::reg;
+    constexpr std::size_t W = Ops::width;
+    constexpr unsigned all = (W == 32 ? ~0u : ((1u << W) - 1u));
+    const std::size_t s = job.stride;
+
+    std::size_t filled = 0;
+    std::size_t i = 0;
+    for (; i + W <= job.count; i += W) {
+        const R nx0 = Ops::load(job.n[0], i, s);
+        const R ny0 = Ops::load(job.n[1], i, s);
+        const R nz0 = Ops::load(job.n[2], i, s);
+        unsigned lanes = all;
+        if (only_missing) {
+            const R sum = Ops::add(Ops::add(Ops::abs(nx0), Ops::abs(ny0)), Ops::abs(nz0));
+            lanes = Ops::lt_mask(sum, Ops::set1(1e-20f));
+            if (lanes == 0) continue;
+        }
+        const R ax = Ops::load(job.v[0][0], i, s);
+        const R ay = Ops::load(job.v[0][1], i, s);
+        const R az = Ops::load(job.v[0][2], i, s);
+        const R e1x = Ops::sub(Ops::load(job.v[1][0], i, s), ax);
+        const R e1y = Ops::sub(Ops::load(job.v[1][1], i, s), ay);
+        const R e1z = Ops::sub(Ops::load(job.v[1][2], i, s), az);
+        const R e2x = Ops::sub(Ops::load(job.v[2][0], i, s), ax);
+        const R e2y = Ops::sub(Ops::load(job.v[2][1], i, s), ay);
+        const R e2z = Ops::sub(Ops::load(job.v[2][2], i, s), az);
+
+        R nx = Ops::sub(Ops::mul(e1y, e2z), Ops::mul(e1z, e2y));
+        R ny = Ops::sub(Ops::mul(e1z, e2x), Ops::mul(e1x, e2z));
+        R nz = Ops::sub(Ops::mul(e1x, e2y), Ops::mul(e1y, e2x));
+        const R len = Ops::sqrt(Ops::add(Ops::add(Ops::mul(nx, nx), Ops::mul(ny, ny)), Ops::mul(nz, nz)));
+        const R zero = Ops::set1(0.0f);
+        nx = Ops::select_gt(len, zero, Ops::div(nx, len), nx);
+        ny = Ops::select_gt(len, zero, Ops::div(ny, len), ny);
+        nz = Ops::select_gt(len, zero, Ops::div(nz, len), nz);
+
+        Ops::store(job.n[0], i, s, nx, lanes);
+        Ops::store(job.n[1], i, s, ny, lanes);
+        Ops::store(job.n[2], i, s, nz, lanes);
+        filled += popcount_bits(lanes);
+    }
+    for (; i < job.count; ++i)
+        filled += normal_one(job, i, only_missing, [](float x) noexcept { return Ops::sqrt_scalar(x); }) ? 1 : 0;
+    return filled;
+}
+
+// One face of a measuring pass; the normal, when written, is bit-identical
+// to normal_one()'s
+template <class Sqrt>
+inline void measure_one(const NormalJob& job, std::size_t i, NormalMode mode, MeasureSums& m,
+                        Sqrt sqrt_f) noexcept {
+    const std::size_t o = i * job.stride;
+    for (std::size_t s = 0; s < 3; ++s)
+        for (std::size_t k = 0; k < 3; ++k) {
+            const float c = job.v[s][k][o];
+            m.lo[k] = c < m.lo[k] ? c : m.lo[k];
+            m.hi[k] = c > m.hi[k] ? c : m.hi[k];
+        }
+
+    const float ax = job.v[0][0][o], ay = job.v[0][1][o], az = job.v[0][2][o];
+    const float e1x = job.v[1][0][o] - ax, e1y = job.v[1][1][o] - ay, e1z = job.v[1][2][o] - az;
+    const float e2x = job.v[2][0][o] - ax, e2y = job.v[2][1][o] - ay, e2z = job.v[2][2][o] - az;
+    float nx = e1y * e2z - e1z * e2y;
+    float ny = e1z * e2x - e1x * e2z;
+    float nz = e1x * e2y - e1y * e2x;
+    const float len = sqrt_f(nx * nx + ny * ny + nz * nz);
+    m.area2 += len;
+    m.volume6 += ax * nx + ay * ny + az * nz;
+    if (!(len > 0.0f)) ++m.degenerate;
+
+    if (mode == NormalMode::keep) return;
+    if (mode == NormalMode::missing && !(abs_f(job.n[0][o]) + abs_f(job.n[1][o]) + abs_f(job.n[2][o]) < 1e-20f))
+        return;
+    if (len > 0.0f) { nx /= len; ny /= len; nz /= len; }
+    job.n[0][o] = nx; job.n[1][o] = ny; job.n[2][o] = nz;
+    ++m.filled;
+}
+
+/// Generic SIMD measuring pass: bounds, area, volume and degeneracy from
+/// the cross products normals_simd() computes, writing normals per `mode`.
+/// Lane sums are moved into the double totals every few blocks.
+template <class Ops>
+inline void measure_simd(const NormalJob& job, NormalMode mode, MeasureSums& m) noexcept {
+    using R = typename Ops::reg;
+    constexpr std::size_t W = Ops::width;
+    constexpr unsigned all = (W == 32 ? ~0u : ((1u << W) - 1u));
+    constexpr std::size_t flush_every = 64;
+    const std::size_t s = job.stride;
+    const R zero = Ops::set1(0.0f);
+
+    R lo[3], hi[3];
+    for (std::size_t k = 0; k < 3; ++k) { lo[k] = Ops::set1(m.lo[k]); hi[k] = Ops::set1(m.hi[k]); }
+    R area = zero, volume = zero;
+    std::size_t pending = 0;
+    auto flush = [&]() noexcept {
+        float a[W], v[W];
+        Ops::store(a, 0, 1, area, all);
+        Ops::store(v, 0, 1, volume, all);
+        for (std::size_t k = 0; k < W; ++k) { m.area2 += a[k]; m.volume6 += v[k]; }
+        area = zero;
+        volume = zero;
+        pending = 0;
+    };
+
+    std::size_t i = 0;
+    for (; i + W <= job.count; i += W) {
+        R p[3][3];
+        for (std::size_t v = 0; v < 3; ++v)
+            for (std::size_t k = 0; k < 3; ++k) {
+                p[v][k] = Ops::load(job.v[v][k], i, s);
+                lo[k] = Ops::min(p[v][k], lo[k]);
+                hi[k] = Ops::max(p[v][k], hi[k]);
+            }
+        const R e1x = Ops::sub(p[1][0], p[0][0]), e1y = Ops::sub(p[1][1], p[0][1]), e1z = Ops::sub(p[1][2], p[0][2]);
+        const R e2x = Ops::sub(p[2][0], p[0][0]), e2y = Ops::sub(p[2][1], p[0][1]), e2z = Ops::sub(p[2][2], p[0][2]);
+        const R nx = Ops::sub(Ops::mul(e1y, e2z), Ops::mul(e1z, e2y));
+        const R ny = Ops::sub(Ops::mul(e1z, e2x), Ops::mul(e1x, e2z));
+        const R nz = Ops::sub(Ops::mul(e1x, e2y), Ops::mul(e1y, e2x));
+        const R len = Ops::sqrt(Ops::add(Ops::add(Ops::mul(nx, nx), Ops::mul(ny, ny)), Ops::mul(nz, nz)));
+        area = Ops::add(area, len);
+        volume = Ops::add(volume, Ops::add(Ops::add(Ops::mul(p[0][0], nx), Ops::mul(p[0][1], ny)),
+                                           Ops::mul(p[0][2], nz)));
+        m.degenerate += popcount_bits(all & ~Ops::lt_mask(zero, len));
+        if (++pending == flush_every) flush();
+
+        if (mode == NormalMode::keep) continue;
+        unsigned lanes = all;
+        if (mode == NormalMode::missing) {
+            const R sum = Ops::add(Ops::add(Ops::abs(Ops::load(job.n[0], i, s)), Ops::abs(Ops::load(job.n[1], i, s))),
+                                   Ops::abs(Ops::load(job.n[2], i, s)));
+            lanes = Ops::lt_mask(sum, Ops::set1(1e-20f));
+            if (lanes == 0) continue;
+        }
+        Ops::store(job.n[0], i, s, Ops::select_gt(len, zero, Ops::div(nx, len), nx), lanes);
+        Ops::store(job.n[1], i, s, Ops::select_gt(len, zero, Ops::div(ny, len), ny), lanes);
+        Ops::store(job.n[2], i, s, Ops::select_gt(len, zero, Ops::div(nz, len), nz), lanes);
+        m.filled += popcount_bits(lanes);
+    }
+    flush();
+    for (std::size_t k = 0; k < 3; ++k) {
+        float l[W], h[W];
+        Ops::store(l, 0, 1, lo[k], all);
+        Ops::store(h, 0, 1, hi[k], all);
+        for (std::size_t j = 0; j < W; ++j) {
+            m.lo[k] = l[j] < m.lo[k] ? l[j] : m.lo[k];
+            m.hi[k] = h[j] > m.hi[k] ? h[j] : m.hi[k];
+        }
+    }
+    for (; i < job.count; ++i)
+        measure_one(job, i, mode, m, [](float x) noexcept { return Ops::sqrt_scalar(x); });
+}
+
+} // namespace
+
+} // namespace Harmony::STL::detail
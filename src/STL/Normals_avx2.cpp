@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Compiled with AVX2 enabled; only called after a runtime CPU check.
+
+#include <immintrin.h>
+
+#include "NormalsKernel.h"
+
+namespace Harmony::STL::detail {
+
+namespace {
+
+struct Avx2Ops {
+    using reg = __m256;
+    static constexpr std::size_t width = 8;
+
+    static reg load(const float* p, std::size_t i, std::size_t s) noexcept {
+        if (s == 1) return _mm256_loadu_ps(p + i);
+        const int is = static_cast<int>(s);
+        const __m256i idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(is));
+        return _mm256_i32gather_ps(p + i * s, idx, 4);
+    }
+    static void store(float* p, std::size_t i, std::size_t s, reg v, unsigned lanes) noexcept {
+        if (s == 1 && lanes == 0xFFu) { _mm256_storeu_ps(p + i, v); return; }
+        alignas(32) float tmp[8];
+        _mm256_store_ps(tmp, v);
+        for (std::size_t k = 0; k < 8; ++k)
+            if (lanes >> k & 1u) p[(i + k) * s] = tmp[k];
+    }
+    static reg set1(float x) noexcept { return _mm256_set1_ps(x); }
+    static reg add(reg a, reg b) noexcept { return _mm256_add_ps(a, b); }
+    static reg sub(reg a, reg b) noexcept { return _mm256_sub_ps(a, b); }
+    static reg mul(reg a, reg b) noexcept { return _mm256_mul_ps(a, b); }
+    static reg div(reg a, reg b) noexcept { return _mm256_div_ps(a, b); }
+    static reg sqrt(reg a) noexcept { return _mm256_sqrt_ps(a); }
+    static reg abs(reg a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    // a < b ? a : b and a > b ? a : b, so a NaN `a` keeps `b`
+    static reg min(reg a, reg b) noexcept { return _mm256_min_ps(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm256_max_ps(a, b); }
+    static unsigned lt_mask(reg a, reg b) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)));
+    }
+    // a > b ? x : y
+    static reg select_gt(reg a, reg b, reg x, reg y) noexcept {
+        return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_GT_OQ));
+    }
+    static float sqrt_scalar(float x) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x))); }
+};
+
+} // namespace
+
+std::size_t normals_avx2(const NormalJob& job, bool only_missing) noexcept {
+    return normals_simd<Avx2Ops>(job, only_missing);
+}
+
+void measure_avx2(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept {
+    measure_simd<Avx2Ops>(job, mode, sums);
+}
+
+} // namespace Harmony::STL::detail
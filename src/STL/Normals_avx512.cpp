@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Compiled with AVX-512F enabled; only called after a runtime CPU check.
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) && !defined(__clang__)
+    // GCC 12 flags the _mm512_undefined_ps() pass-through operand of its own intrinsics
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include "NormalsKernel.h"
+
+namespace Harmony::STL::detail {
+
+namespace {
+
+struct Avx512Ops {
+    using reg = __m512;
+    static constexpr std::size_t width = 16;
+
+    static __m512i index(std::size_t s) noexcept {
+        return _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                                  _mm512_set1_epi32(static_cast<int>(s)));
+    }
+    static reg load(const float* p, std::size_t i, std::size_t s) noexcept {
+        if (s == 1) return _mm512_loadu_ps(p + i);
+        return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, index(s), p + i * s, 4);
+    }
+    static void store(float* p, std::size_t i, std::size_t s, reg v, unsigned lanes) noexcept {
+        const auto m = static_cast<__mmask16>(lanes);
+        if (s == 1) _mm512_mask_storeu_ps(p + i, m, v);
+        else _mm512_mask_i32scatter_ps(p + i * s, m, index(s), v, 4);
+    }
+    static reg set1(float x) noexcept { return _mm512_set1_ps(x); }
+    static reg add(reg a, reg b) noexcept { return _mm512_add_ps(a, b); }
+    static reg sub(reg a, reg b) noexcept { return _mm512_sub_ps(a, b); }
+    static reg mul(reg a, reg b) noexcept { return _mm512_mul_ps(a, b); }
+    static reg div(reg a, reg b) noexcept { return _mm512_div_ps(a, b); }
+    static reg sqrt(reg a) noexcept { return _mm512_sqrt_ps(a); }
+    static reg abs(reg a) noexcept { return _mm512_abs_ps(a); }
+    // a < b ? a : b and a > b ? a : b, so a NaN `a` keeps `b`
+    static reg min(reg a, reg b) noexcept { return _mm512_min_ps(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm512_max_ps(a, b); }
+    static unsigned lt_mask(reg a, reg b) noexcept {
+        return static_cast<unsigned>(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ));
+    }
+    // a > b ? x : y
+    static reg select_gt(reg a, reg b, reg x, reg y) noexcept {
+        return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_GT_OQ), y, x);
+    }
+    static float sqrt_scalar(float x) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x))); }
+};
+
+} // namespace
+
+std::size_t normals_avx512(const NormalJob& job, bool only_missing) noexcept {
+    return normals_simd<Avx512Ops>(job, only_missing);
+}
+
+void measure_avx512(const NormalJob& job, NormalMode mode, MeasureSums& sums) noexcept {
+    measure_simd<Avx512Ops>(job, mode, sums);
+}
+
+} // namespace Harmony::STL::detail
@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Internal: minimal fork-join helper for the chunked parsers/serializers.
+// Inside a WorkPool worker the tasks are forked onto the pool instead.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "WorkPool.h"
+
+namespace Harmony::STL::detail {
+
+/// 0 means "all hardware threads"
+inline unsigned resolve_threads(unsigned requested) noexcept {
+    if (requested != 0) return requested;
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/// Call fn(i) for every i in [0, n) on up to `threads` threads, the calling
+/// thread included. Tasks are handed out dynamically; the first exception
+/// thrown by a task is rethrown once all threads have joined (once every
+/// task has finished, on a WorkPool).
+template <class F>
+void parallel_for(std::size_t n, unsigned threads, F&& fn) {
+    const std::size_t workers = std::min<std::size_t>(n, resolve_threads(threads));
+    if (workers <= 1) {
+        for (std::size_t i = 0; i < n; ++i) fn(i);
+        return;
+    }
+
+    if (WorkPool* pool = WorkPool::current()) {
+        // Helpers still queued when the loop is over find no index left and
+        // return; the counters they check are kept alive by the shared state
+        struct Fork {
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> done{0};
+            std::exception_ptr failure;
+            std::mutex failure_mutex;
+        };
+        const auto state = std::make_shared<Fork>();
+        auto run = [state, n, call = &fn] {
+            for (std::size_t i; (i = state->next.fetch_add(1, std::memory_order_relaxed)) < n;) {
+                try {
+                    (*call)(i);
+                } catch (...) {
+                    std::lock_guard lock(state->failure_mutex);
+                    if (!state->failure) state->failure = std::current_exception();
+                }
+                if (state->done.fetch_add(1, std::memory_order_release) + 1 == n) state->done.notify_all();
+            }
+        };
+        for (std::size_t t = 1; t < workers; ++t) pool->push(run);
+        run();
+        // Only indices already being run elsewhere remain: run other queued
+        // tasks meanwhile, or sleep until the last index is done
+        for (std::size_t d; (d = state->done.load(std::memory_order_acquire)) < n;)
+            if (!pool->run_one()) state->done.wait(d, std::memory_order_acquire);
+        if (state->failure) std::rethrow_exception(state->failure);
+        return;
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto run = [&] {
+        for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < n;) {
+            try {
+                fn(i);
+            } catch (...) {
+                std::lock_guard lock(failure_mutex);
+                if (!failure) failure = std::current_exception();
+            }
+        }
+    };
+    {
+        std::vector<std::jthread> pool;
+        pool.reserve(workers - 1);
+        for (std::size_t t = 1; t < workers; ++t) pool.emplace_back(run);
+        run();
+    }
+    if (failure) std::rethrow_exception(failure);
+}
+
+} // namespace Harmony::STL::detail
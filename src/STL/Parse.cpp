@@ -6,30 +6,135 @@
 // License - Filename : LICENSE
 // ----------------------------------------------------------------------
 
+#include <algorithm>
+#include <exception>
+#include <format>
+#include <numeric>
+#include <system_error>
+
 #include "Harmony/STL/Parse.h"
+#include "Harmony/STL/MappedFile.h"
+#include "Harmony/STL/Reader.h"
+#include "Parallel.h"
+#include "WorkPool.h"
 
 namespace Harmony::STL {
 
+namespace {
+
+// How far past the start a "solid" header is checked for binary bytes
+constexpr std::size_t text_probe_bytes = 512;
+
+// Optional leading whitespace, "solid" in any case, then whitespace or the end
+bool starts_with_solid(std::string_view s) noexcept {
+    std::size_t i = 0;
+    while (i < s.size() && (s[i] == ' ' || s[i] == '\t' || s[i] == '\r' || s[i] == '\n')) ++i;
+    constexpr std::string_view kw = "solid";
+    if (s.size() - i < kw.size()) return false;
+    for (std::size_t k = 0; k < kw.size(); ++k)
+        if (static_cast<char>(s[i + k] | 0x20) != kw[k]) return false;
+    i += kw.size();
+    return i == s.size() || s[i] == ' ' || s[i] == '\t' || s[i] == '\r' || s[i] == '\n';
+}
+
+// NUL and control bytes other than whitespace never occur in ASCII STL
+bool has_binary_bytes(std::string_view s) noexcept {
+    return std::ranges::any_of(s, [](char c) {
+        const auto u = static_cast<unsigned char>(c);
+        return u < 0x09 || (u > 0x0d && u < 0x20) || u == 0x7f;
+    });
+}
+
+} // namespace
+
+Format detect_format(std::string_view head, std::optional<std::size_t> total_size) noexcept {
+    if (head.size() >= Binary::prefix_size && total_size) {
+        const std::uint32_t count = Binary::load_le<std::uint32_t>(
+            std::span<const std::byte, 4>(reinterpret_cast<const std::byte*>(head.data()) + Binary::header_size, 4));
+        if (*total_size == Binary::serialized_size(count)) return Format::binary;
+    }
+    if (!starts_with_solid(head)) return Format::binary;
+    if (has_binary_bytes(head.substr(0, text_probe_bytes))) return Format::binary;
+    return Format::ascii;
+}
+
 std::expected<Mesh, std::string>
 parse(std::istream& is, bool compute_missing_normals) {
-    // Remember position
-    auto pos = is.tellg();
-    if (pos == std::streampos(-1)) pos = std::streampos(0);
-
-    // Read first 6 bytes ("solid " for ASCII)
-    char probe[6]{};
-    is.read(probe, 6);
-    const auto readOk = is.gcount();
-    is.clear(); // clear eof if short files
-    is.seekg(pos);
-
-    if (readOk == 6 && std::string_view(probe,6) == std::string_view("solid ")) {
-        return ASCII::parse(is, compute_missing_normals); // ASCII path (your existing function)
+    auto reader = Reader::open(is, compute_missing_normals);
+    if (!reader) return std::unexpected(std::move(reader.error()));
+    reader->limit_line_length(0); // the mesh is held whole anyway
+    return read_mesh(*reader);
+}
+
+std::expected<Mesh, std::string>
+parse(std::string_view bytes, bool compute_missing_normals) noexcept {
+    if (detect_format(bytes) == Format::binary) return Binary::parse(bytes, compute_missing_normals);
+    return ASCII::parse(bytes, compute_missing_normals);
+}
+
+std::expected<Mesh, std::string>
+parse(std::string_view bytes, const ParseOptions& options) {
+    if (detect_format(bytes) == Format::binary) return Binary::parse(bytes, options);
+    return ASCII::parse(bytes, options);
+}
+
+std::expected<void, std::string>
+parse_into(std::string_view bytes, Mesh& mesh, const ParseOptions& options) {
+    if (detect_format(bytes) == Format::binary) return Binary::parse_into(bytes, mesh, options);
+    return ASCII::parse_into(bytes, mesh, options);
+}
+
+std::expected<pmr::Mesh, std::string>
+parse(std::string_view bytes, std::pmr::memory_resource* resource, bool compute_missing_normals) noexcept {
+    if (detect_format(bytes) == Format::binary) return Binary::parse(bytes, resource, compute_missing_normals);
+    return ASCII::parse(bytes, resource, compute_missing_normals);
+}
+
+std::expected<Mesh, std::string>
+load(const std::filesystem::path& path, bool compute_missing_normals) {
+    ParseOptions options;
+    options.compute_missing_normals = compute_missing_normals;
+    return load(path, options);
+}
+
+std::expected<Mesh, std::string>
+load(const std::filesystem::path& path, const ParseOptions& options) {
+    auto mapped = MappedFile::open(path);
+    if (!mapped) return std::unexpected(std::format("STL: {}", mapped.error()));
+    return parse(mapped->view(), options);
+}
+
+std::vector<std::expected<Mesh, std::string>>
+load_many(std::span<const std::filesystem::path> paths, const LoadManyOptions& options) {
+    std::vector<std::expected<Mesh, std::string>> results(paths.size());
+    detail::WorkPool pool(detail::resolve_threads(options.threads));
+    ParseOptions parse_options = options.options;
+    parse_options.geometry = nullptr;
+    // The parsers' own size thresholds decide whether a file is split
+    parse_options.threads = pool.size();
+
+    // Largest first, so the long files are not the ones left at the end;
+    // an unreadable size sorts last and load() reports the error
+    std::vector<std::uintmax_t> sizes(paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        std::error_code ec;
+        sizes[i] = std::filesystem::file_size(paths[i], ec);
+        if (ec) sizes[i] = 0;
     }
+    std::vector<std::size_t> order(paths.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::ranges::stable_sort(order, std::ranges::greater{}, [&](std::size_t i) { return sizes[i]; });
 
-    // Binary path: read header+count, then restore stream and call binary parser
-    // (Some ASCII files also start with "solid<no-space>", catch those by trying ASCII first)
-    return Binary::parse(is, compute_missing_normals);
+    for (const std::size_t i : order)
+        pool.push([&, i] {
+            try {
+                results[i] = load(paths[i], parse_options);
+            } catch (const std::exception& e) {
+                results[i] = std::unexpected(std::format("STL: {}", e.what()));
+            }
+        });
+    pool.run();
+    return results;
 }
 
 } // namespace Harmony::STL
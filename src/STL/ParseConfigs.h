@@ -0,0 +1,26 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Internal: every ParseConfig, for the explicit instantiations of
+// parse<Config>() (the headers only declare it). X(config) is expanded
+// once per combination.
+
+#pragma once
+
+#include "Harmony/STL/ParseConfig.h"
+
+#define HARMONY_PARSE_CONFIG(N, V, L) \
+    (::Harmony::STL::ParseConfig{::Harmony::STL::NormalPolicy::N, V, ::Harmony::STL::MeshLayout::L})
+
+#define HARMONY_FOR_EACH_PARSE_CONFIG(X)                                                              \
+    X(HARMONY_PARSE_CONFIG(keep, true, aos)) X(HARMONY_PARSE_CONFIG(keep, true, soa))                 \
+    X(HARMONY_PARSE_CONFIG(keep, false, aos)) X(HARMONY_PARSE_CONFIG(keep, false, soa))               \
+    X(HARMONY_PARSE_CONFIG(fill_missing, true, aos)) X(HARMONY_PARSE_CONFIG(fill_missing, true, soa)) \
+    X(HARMONY_PARSE_CONFIG(fill_missing, false, aos)) X(HARMONY_PARSE_CONFIG(fill_missing, false, soa)) \
+    X(HARMONY_PARSE_CONFIG(recompute, true, aos)) X(HARMONY_PARSE_CONFIG(recompute, true, soa))       \
+    X(HARMONY_PARSE_CONFIG(recompute, false, aos)) X(HARMONY_PARSE_CONFIG(recompute, false, soa))
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <format>
+#include <fstream>
+#include <istream>
+#include <system_error>
+
+#include "Harmony/STL/Parser.h"
+#include "Harmony/STL/MappedFile.h"
+#include "Harmony/STL/Parse.h"
+
+namespace Harmony::STL {
+
+namespace {
+
+constexpr std::size_t read_block_bytes = 64 * 1024;
+constexpr std::uintmax_t map_threshold_bytes = 4 * 1024 * 1024; // map instead of read from here on
+
+} // namespace
+
+std::expected<void, std::string> Parser::parse_into(std::string_view bytes, Mesh& mesh) {
+    return STL::parse_into(bytes, mesh, options_);
+}
+
+std::expected<void, std::string> Parser::parse_into(std::istream& is, Mesh& mesh) {
+    buffer_.clear();
+    while (is) {
+        const std::size_t old = buffer_.size();
+        buffer_.resize(old + read_block_bytes);
+        is.read(buffer_.data() + old, static_cast<std::streamsize>(read_block_bytes));
+        buffer_.resize(old + static_cast<std::size_t>(is.gcount()));
+    }
+    if (is.bad()) {
+        mesh.tris.clear();
+        mesh.attributes.clear();
+        return std::unexpected(std::string("I/O error while reading stream"));
+    }
+    return parse_into(std::string_view(buffer_), mesh);
+}
+
+std::expected<void, std::string> Parser::load_into(const std::filesystem::path& path, Mesh& mesh) {
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (!ec && size >= map_threshold_bytes) {
+        auto mapped = MappedFile::open(path);
+        if (!mapped) {
+            mesh.tris.clear();
+            mesh.attributes.clear();
+            return std::unexpected(std::format("STL: {}", mapped.error()));
+        }
+        return parse_into(mapped->view(), mesh);
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        mesh.tris.clear();
+        mesh.attributes.clear();
+        return std::unexpected(std::format("STL: Cannot open '{}'", path.string()));
+    }
+    if (!ec) buffer_.reserve(static_cast<std::size_t>(size));
+    return parse_into(file, mesh);
+}
+
+} // namespace Harmony::STL
@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <format>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "Harmony/STL/ProgressiveLoader.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/MappedFile.h"
+#include "Parallel.h"
+
+namespace Harmony::STL::Binary {
+
+struct ProgressiveLoader::State {
+    struct Slot {
+        std::optional<TriangleRange> range;
+        std::exception_ptr failure;
+        bool done = false;
+    };
+
+    MappedFile file;
+    std::string name;
+    std::size_t size = 0;
+    std::size_t max_ready = 1;
+    ParseOptions options;
+    std::vector<std::pair<std::size_t, std::size_t>> plan; // (first, count) per range
+
+    std::mutex mutex;
+    std::condition_variable ready_cv; // a slot was filled
+    std::condition_variable space_cv; // next() took a range, or stopping
+    std::vector<Slot> slots;
+    std::size_t next_task = 0;
+    std::size_t taken = 0;     // ranges handed out by next()
+    std::size_t delivered = 0; // their triangles
+    bool stopping = false;
+
+    std::vector<std::jthread> threads;
+
+    explicit State(MappedFile mapped) : file(std::move(mapped)) {}
+
+    ~State() {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        space_cv.notify_all();
+        threads.clear(); // joins
+    }
+
+    void decode_loop() {
+        std::unique_lock lock(mutex);
+        for (;;) {
+            space_cv.wait(lock, [&] { return stopping || next_task == plan.size() || next_task < taken + max_ready; });
+            if (stopping || next_task == plan.size()) break;
+            const std::size_t task = next_task++;
+            lock.unlock();
+
+            Slot slot;
+            try {
+                auto mesh = parse_range(file.view(), plan[task].first, plan[task].second, options);
+                // Validated in open() and the mapping cannot shrink under us
+                if (!mesh) throw std::runtime_error(mesh.error());
+                slot.range.emplace(TriangleRange{plan[task].first, std::move(mesh->tris)});
+            } catch (...) {
+                slot.failure = std::current_exception();
+            }
+            slot.done = true;
+
+            lock.lock();
+            slots[task] = std::move(slot);
+            ready_cv.notify_all();
+        }
+    }
+};
+
+ProgressiveLoader::ProgressiveLoader(std::unique_ptr<State> state) noexcept : state_(std::move(state)) {}
+ProgressiveLoader::ProgressiveLoader(ProgressiveLoader&& other) noexcept = default;
+ProgressiveLoader& ProgressiveLoader::operator=(ProgressiveLoader&& other) noexcept = default;
+ProgressiveLoader::~ProgressiveLoader() = default;
+
+std::expected<ProgressiveLoader, std::string> ProgressiveLoader::open(const std::filesystem::path& path) {
+    return open(path, Config{});
+}
+
+std::expected<ProgressiveLoader, std::string>
+ProgressiveLoader::open(const std::filesystem::path& path, const Config& config) {
+    auto mapped = MappedFile::open(path);
+    if (!mapped) return std::unexpected(std::format("Binary STL: {}", mapped.error()));
+    auto view = View::open(mapped->view());
+    if (!view) return std::unexpected(std::move(view.error()));
+
+    auto state = std::make_unique<State>(std::move(*mapped));
+    State& s = *state;
+    s.name = view->name();
+    s.size = view->size();
+    s.max_ready = std::max<std::size_t>(1, config.max_ready);
+    s.options.compute_missing_normals = config.compute_missing_normals;
+    const std::size_t max_range = std::max<std::size_t>(1, config.max_range);
+    for (std::size_t first = 0, n = std::clamp<std::size_t>(config.first_range, 1, max_range); first < s.size;
+         first += n, n = std::min(n * 2, max_range))
+        s.plan.emplace_back(first, std::min(n, s.size - first));
+    s.slots.resize(s.plan.size());
+
+    const std::size_t workers = std::min<std::size_t>(STL::detail::resolve_threads(config.threads), s.plan.size());
+    s.threads.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) s.threads.emplace_back([&s] { s.decode_loop(); });
+    return ProgressiveLoader(std::move(state));
+}
+
+std::optional<TriangleRange> ProgressiveLoader::next() {
+    State& s = *state_;
+    std::unique_lock lock(s.mutex);
+    if (s.taken == s.plan.size()) return std::nullopt;
+    s.ready_cv.wait(lock, [&] { return s.slots[s.taken].done; });
+    State::Slot slot = std::move(s.slots[s.taken]);
+    ++s.taken;
+    if (slot.range) s.delivered += slot.range->tris.size();
+    lock.unlock();
+    s.space_cv.notify_all();
+    if (slot.failure) std::rethrow_exception(slot.failure);
+    return std::move(slot.range);
+}
+
+std::size_t ProgressiveLoader::size() const noexcept { return state_->size; }
+
+const std::string& ProgressiveLoader::name() const noexcept { return state_->name; }
+
+std::size_t ProgressiveLoader::delivered() const noexcept {
+    std::lock_guard lock(state_->mutex);
+    return state_->delivered;
+}
+
+} // namespace Harmony::STL::Binary
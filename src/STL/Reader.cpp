@@ -0,0 +1,283 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <istream>
+
+#include "Harmony/STL/Reader.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Normals.h"
+#include "AsciiScanner.h"
+#include "FinishFaces.h"
+#include "Instrument.h"
+
+namespace Harmony::STL {
+
+namespace {
+
+using detail::PhaseTimer;
+
+constexpr std::size_t text_block_bytes = 64 * 1024;
+constexpr std::size_t binary_block_records = 4096;
+
+// Read up to n bytes; short only at end of stream or on error
+std::size_t read_some(std::istream& is, char* dst, std::size_t n) {
+    std::size_t got = 0;
+    while (got < n && is) {
+        is.read(dst + got, static_cast<std::streamsize>(n - got));
+        got += static_cast<std::size_t>(is.gcount());
+    }
+    return got;
+}
+
+// Bytes from `start` to the end of a seekable stream; the read position is kept
+std::optional<std::size_t> stream_size(std::istream& is, std::streampos start) {
+    if (start == std::streampos(-1)) return std::nullopt;
+    const auto here = is.tellg();
+    if (here == std::streampos(-1) || !is.seekg(0, std::ios::end)) {
+        is.clear();
+        return std::nullopt;
+    }
+    const auto end = is.tellg();
+    is.seekg(here);
+    if (end == std::streampos(-1) || !is) {
+        is.clear();
+        is.seekg(here);
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(end - start);
+}
+
+} // namespace
+
+struct Reader::State {
+    std::unique_ptr<std::ifstream> file; // set when opened from a path
+    std::istream* is = nullptr;
+    Format format = Format::ascii;
+    bool compute_missing_normals = true;
+    bool measure = false;
+    std::size_t max_line_bytes = default_max_line_bytes; // 0: unlimited
+    GeometryStats geometry;
+    bool finished = false; // input fully consumed
+    bool done = false;     // next_batch() reported the end or an error
+    std::string error;     // sticky
+
+    // ASCII: unconsumed text in buf[pos, size)
+    ASCII::detail::Scanner scanner;
+    std::string buf;
+    std::size_t pos = 0;
+    std::size_t line_no = 0;
+    bool eof = false;
+
+    // Binary
+    std::string name;
+    std::size_t count = 0;
+    std::size_t remaining = 0;
+    std::vector<std::byte> block;
+
+    std::unexpected<std::string> fail(std::string message) {
+        error = std::move(message);
+        done = true;
+        return std::unexpected(error);
+    }
+
+    // Append the next block of text; false on a stream error
+    bool refill() {
+        buf.erase(0, pos);
+        pos = 0;
+        const std::size_t old = buf.size();
+        buf.resize(old + text_block_bytes);
+        const PhaseTimer timer(&Stats::io);
+        const std::size_t got = read_some(*is, buf.data() + old, text_block_bytes);
+        detail::count(&Stats::bytes_read, got);
+        buf.resize(old + got);
+        if (got < text_block_bytes) eof = true;
+        return !is->bad();
+    }
+
+    // `prefix` holds the first `got` bytes of the stream
+    std::expected<void, std::string> start_binary(const char* prefix, std::size_t got) {
+        format = Format::binary;
+        if (got < Binary::header_size)
+            return std::unexpected(std::string("Binary STL: failed to read 80-byte header"));
+        if (got < Binary::prefix_size)
+            return std::unexpected(std::string("Binary STL: failed to read triangle count"));
+        const auto* bytes = reinterpret_cast<const std::byte*>(prefix);
+        name = Binary::header_name(std::span<const std::byte, Binary::header_size>(bytes, Binary::header_size));
+        count = remaining = Binary::load_le<std::uint32_t>(
+            std::span<const std::byte, 4>(bytes + Binary::header_size, 4));
+        return {};
+    }
+
+    std::expected<std::size_t, std::string> next_ascii(std::span<Triangle> out) {
+        using ASCII::detail::Scanner;
+        std::size_t n = 0;
+        while (n < out.size() && !finished) {
+            // Whole lines in the buffer are scanned, then it is refilled
+            bool need_more = false;
+            {
+                const PhaseTimer timer(&Stats::scan);
+                while (n < out.size() && !finished) {
+                    const char* b = buf.data() + pos;
+                    const std::size_t avail = buf.size() - pos;
+                    const auto* nl = static_cast<const char*>(std::memchr(b, '\n', avail));
+                    if (!nl && !eof) {
+                        if (max_line_bytes && avail >= max_line_bytes)
+                            return fail(std::format("Line {}: longer than {} bytes", line_no + 1, max_line_bytes));
+                        need_more = true;
+                        break;
+                    }
+                    if (!nl && avail == 0) {
+                        if (scanner.finish() == Scanner::Result::error) return fail(std::move(scanner.error));
+                        finished = true;
+                        break;
+                    }
+                    const std::size_t len = nl ? static_cast<std::size_t>(nl - b) : avail;
+                    const auto r = scanner.line(std::string_view(b, len), ++line_no);
+                    detail::count(&Stats::lines);
+                    pos += nl ? len + 1 : len;
+                    if (r == Scanner::Result::facet) out[n++] = scanner.triangle;
+                    else if (r == Scanner::Result::end) finished = true; // rest of the input is ignored
+                    else if (r == Scanner::Result::error) return fail(std::move(scanner.error));
+                }
+            }
+            if (need_more && !refill()) return fail("I/O error while reading stream");
+        }
+        return n;
+    }
+
+    std::expected<std::size_t, std::string> next_binary(std::span<Triangle> out) {
+        const std::size_t n = std::min(out.size(), remaining);
+        for (std::size_t done_now = 0; done_now < n;) {
+            const std::size_t k = std::min(n - done_now, binary_block_records);
+            block.resize(k * Binary::record_size);
+            {
+                const PhaseTimer timer(&Stats::io);
+                if (!Binary::read_exact(*is, block))
+                    return fail("Binary STL: unexpected EOF in triangle data");
+                detail::count(&Stats::bytes_read, block.size());
+            }
+            const PhaseTimer timer(&Stats::decode);
+            for (std::size_t i = 0; i < k; ++i)
+                out[done_now + i] = Binary::decode_record(block.data() + i * Binary::record_size);
+            done_now += k;
+        }
+        remaining -= n;
+        if (remaining == 0) finished = true;
+        return n;
+    }
+};
+
+Reader::Reader(std::unique_ptr<State> state) noexcept : state_(std::move(state)) {}
+Reader::Reader(Reader&& other) noexcept = default;
+Reader& Reader::operator=(Reader&& other) noexcept = default;
+Reader::~Reader() = default;
+
+std::expected<Reader, std::string>
+Reader::open(std::istream& is, bool compute_missing_normals) {
+    auto state = std::make_unique<State>();
+    state->is = &is;
+    state->compute_missing_normals = compute_missing_normals;
+
+    // The probe bytes are kept, so the stream is never rewound to them
+    const auto start = is.tellg();
+    char head[Binary::prefix_size];
+    const std::size_t got = read_some(is, head, sizeof head);
+    detail::count(&Stats::bytes_read, got);
+    if (is.bad()) return std::unexpected(std::string("I/O error while reading stream"));
+    const auto total = got < sizeof head ? std::optional<std::size_t>(got) : stream_size(is, start);
+    if (detect_format(std::string_view(head, got), total) == Format::ascii) {
+        state->buf.assign(head, got);
+        state->eof = got < sizeof head;
+    } else if (auto ok = state->start_binary(head, got); !ok) {
+        return std::unexpected(std::move(ok.error()));
+    }
+    return Reader(std::move(state));
+}
+
+std::expected<Reader, std::string>
+Reader::open(std::istream& is, Format format, bool compute_missing_normals) {
+    auto state = std::make_unique<State>();
+    state->is = &is;
+    state->compute_missing_normals = compute_missing_normals;
+    if (format == Format::binary) {
+        char head[Binary::prefix_size];
+        const std::size_t got = read_some(is, head, sizeof head);
+        detail::count(&Stats::bytes_read, got);
+        if (auto ok = state->start_binary(head, got); !ok) return std::unexpected(std::move(ok.error()));
+    }
+    return Reader(std::move(state));
+}
+
+std::expected<Reader, std::string>
+Reader::open(const std::filesystem::path& path, bool compute_missing_normals) {
+    auto file = std::make_unique<std::ifstream>(path, std::ios::binary);
+    if (!*file) return std::unexpected(std::format("Cannot open '{}'", path.string()));
+    auto reader = open(*file, compute_missing_normals);
+    if (reader) reader->state_->file = std::move(file);
+    return reader;
+}
+
+std::expected<std::size_t, std::string> Reader::next_batch(std::span<Triangle> out) {
+    State& s = *state_;
+    if (!s.error.empty()) return std::unexpected(s.error);
+    if (s.finished || out.empty()) {
+        if (s.finished) s.done = true;
+        return 0;
+    }
+    auto n = s.format == Format::ascii ? s.next_ascii(out) : s.next_binary(out);
+    if (!n) return n;
+    detail::count(&Stats::facets, *n);
+    if (*n == 0) {
+        s.done = true;
+    } else if (s.compute_missing_normals || s.measure) {
+        const PhaseTimer timer(&Stats::normals);
+        detail::count(&Stats::normals_computed, detail::finish_faces(out.first(*n), s.compute_missing_normals,
+                                                                     s.measure ? &s.geometry : nullptr));
+    }
+    return n;
+}
+
+Format Reader::format() const noexcept { return state_->format; }
+
+const std::string& Reader::name() const noexcept {
+    return state_->format == Format::ascii ? state_->scanner.name : state_->name;
+}
+
+std::optional<std::size_t> Reader::expected_count() const noexcept {
+    if (state_->format == Format::binary) return state_->count;
+    return std::nullopt;
+}
+
+bool Reader::done() const noexcept { return state_->done; }
+
+void Reader::measure_geometry(bool enable) noexcept { state_->measure = enable; }
+
+const GeometryStats& Reader::geometry() const noexcept { return state_->geometry; }
+
+void Reader::limit_line_length(std::size_t max_bytes) noexcept { state_->max_line_bytes = max_bytes; }
+
+std::expected<Mesh, std::string> read_mesh(Reader& reader) {
+    Mesh mesh;
+    for (;;) {
+        const std::size_t have = mesh.tris.size();
+        if (mesh.tris.capacity() < have + binary_block_records) detail::count(&Stats::reallocations);
+        mesh.tris.resize(have + binary_block_records);
+        auto n = reader.next_batch(std::span<Triangle>(mesh.tris).subspan(have));
+        if (!n) return std::unexpected(std::move(n.error()));
+        mesh.tris.resize(have + *n);
+        if (*n == 0) break;
+    }
+    mesh.name = reader.name();
+    return mesh;
+}
+
+} // namespace Harmony::STL
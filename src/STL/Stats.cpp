@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <memory>
+#include <mutex>
+
+#include "Harmony/STL/Stats.h"
+#include "Instrument.h"
+
+namespace Harmony::STL {
+
+namespace {
+
+std::mutex hook_mutex;
+std::shared_ptr<const StatsHook> hook; // guarded by hook_mutex
+
+[[maybe_unused]] std::shared_ptr<const StatsHook> current_hook() {
+    std::lock_guard lock(hook_mutex);
+    return hook;
+}
+
+#if HARMONY_ENABLE_STATS
+thread_local Stats last;
+thread_local int depth = 0;
+#endif
+
+} // namespace
+
+#if HARMONY_ENABLE_STATS
+
+namespace detail {
+
+StatsScope::StatsScope(const char* operation) noexcept
+    : operation_(operation), start_(std::chrono::steady_clock::now()), outermost_(depth++ == 0) {
+    if (outermost_) thread_stats = Stats{};
+}
+
+StatsScope::~StatsScope() {
+    --depth;
+    if (!outermost_) return;
+    thread_stats.total = std::chrono::steady_clock::now() - start_;
+    last = thread_stats;
+    try {
+        if (const auto h = current_hook(); h && *h) (*h)(operation_, last);
+    } catch (...) {
+        // A throwing hook must not take the parse down with it
+    }
+}
+
+} // namespace detail
+
+Stats last_stats() noexcept { return last; }
+
+#else
+
+Stats last_stats() noexcept { return {}; }
+
+#endif
+
+void set_stats_hook(StatsHook h) {
+    auto next = h ? std::make_shared<const StatsHook>(std::move(h)) : nullptr;
+    std::lock_guard lock(hook_mutex);
+    hook = std::move(next);
+}
+
+} // namespace Harmony::STL
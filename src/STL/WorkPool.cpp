@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+#include "WorkPool.h"
+
+namespace Harmony::STL::detail {
+
+namespace {
+
+thread_local WorkPool* current_pool = nullptr;
+thread_local unsigned current_worker = 0;
+thread_local unsigned help_depth = 0;
+
+// run_one() calls nested inside a task; beyond this a waiter only blocks,
+// so the stack stays bounded
+constexpr unsigned max_help_depth = 8;
+
+} // namespace
+
+WorkPool::WorkPool(unsigned threads)
+    : threads_(std::max(1u, threads)), local_(std::make_unique<Queue[]>(threads_)) {}
+
+WorkPool::~WorkPool() = default;
+
+WorkPool* WorkPool::current() noexcept { return current_pool; }
+
+void WorkPool::push(Task task) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    Queue& q = current_pool == this ? local_[current_worker] : shared_;
+    {
+        std::lock_guard lock(q.mutex);
+        q.tasks.push_back(std::move(task));
+    }
+    queued_.fetch_add(1, std::memory_order_release);
+    // Taking the lock orders the push before a waiting worker's check
+    { std::lock_guard lock(idle_mutex_); }
+    idle_cv_.notify_one();
+}
+
+std::optional<WorkPool::Task> WorkPool::take(unsigned self) {
+    auto pop = [&](Queue& q, bool newest) -> std::optional<Task> {
+        std::lock_guard lock(q.mutex);
+        if (q.tasks.empty()) return std::nullopt;
+        Task t = std::move(newest ? q.tasks.back() : q.tasks.front());
+        if (newest) q.tasks.pop_back();
+        else q.tasks.pop_front();
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        return t;
+    };
+    if (auto t = pop(local_[self], true)) return t;
+    for (unsigned k = 1; k < threads_; ++k)
+        if (auto t = pop(local_[(self + k) % threads_], false)) return t;
+    return pop(shared_, false);
+}
+
+void WorkPool::finished() noexcept {
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    { std::lock_guard lock(idle_mutex_); }
+    idle_cv_.notify_all();
+}
+
+void WorkPool::execute(Task& task) noexcept {
+    try {
+        task();
+    } catch (...) {
+        std::lock_guard lock(idle_mutex_);
+        if (!failure_) failure_ = std::current_exception();
+    }
+    finished();
+}
+
+bool WorkPool::run_one() {
+    if (current_pool != this || help_depth >= max_help_depth) return false;
+    auto task = take(current_worker);
+    if (!task) return false;
+    ++help_depth;
+    execute(*task);
+    --help_depth;
+    return true;
+}
+
+void WorkPool::work(unsigned self) {
+    WorkPool* const outer = std::exchange(current_pool, this);
+    const unsigned outer_worker = std::exchange(current_worker, self);
+    for (;;) {
+        if (auto task = take(self)) {
+            execute(*task);
+            continue;
+        }
+        std::unique_lock lock(idle_mutex_);
+        idle_cv_.wait(lock, [&] {
+            return pending_.load(std::memory_order_acquire) == 0 || queued_.load(std::memory_order_acquire) != 0;
+        });
+        if (pending_.load(std::memory_order_acquire) == 0) break;
+    }
+    current_pool = outer;
+    current_worker = outer_worker;
+}
+
+void WorkPool::run() {
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threads_ - 1);
+        for (unsigned t = 1; t < threads_; ++t) workers.emplace_back([this, t] { work(t); });
+        work(0);
+    }
+    if (failure_) std::rethrow_exception(std::exchange(failure_, nullptr));
+}
+
+} // namespace Harmony::STL::detail
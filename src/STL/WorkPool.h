@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Internal: work-stealing task pool behind load_many(). parallel_for()
+// called from one of its workers forks onto the pool instead of starting
+// threads, so a large file's chunks are picked up by whichever workers
+// are free.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace Harmony::STL::detail {
+
+class WorkPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit WorkPool(unsigned threads);
+    WorkPool(const WorkPool&) = delete;
+    WorkPool& operator=(const WorkPool&) = delete;
+    ~WorkPool();
+
+    /// From a worker: onto its own deque, where it is run last-in first-out
+    /// and stolen from the other end. From any other thread: onto the
+    /// shared queue, which workers only take from when no forked task is
+    /// left to steal.
+    void push(Task task);
+
+    /// Run tasks, the calling thread included, until every task (and every
+    /// task they push) has finished; rethrows the first exception a task let
+    /// escape
+    void run();
+
+    /// From a worker waiting on other tasks: run one queued task in the
+    /// meantime. False when none is queued, or when the calling worker is
+    /// already nested too deep in such waits.
+    bool run_one();
+
+    [[nodiscard]] unsigned size() const noexcept { return threads_; }
+
+    /// The pool the calling thread works for, if any
+    [[nodiscard]] static WorkPool* current() noexcept;
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void work(unsigned self);
+    void execute(Task& task) noexcept;
+    std::optional<Task> take(unsigned self);
+    void finished() noexcept;
+
+    unsigned threads_;
+    std::unique_ptr<Queue[]> local_; // one per worker
+    Queue shared_;
+    std::atomic<std::size_t> queued_{0};  // tasks waiting in any queue
+    std::atomic<std::size_t> pending_{0}; // pushed and not yet finished
+    std::mutex idle_mutex_;
+    std::condition_variable idle_cv_;
+    std::exception_ptr failure_;
+};
+
+} // namespace Harmony::STL::detail
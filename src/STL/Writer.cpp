@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <vector>
+
+#include "Harmony/STL/Writer.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Normals.h"
+#include "AsciiFormat.h"
+#include "Instrument.h"
+
+namespace Harmony::STL {
+
+namespace {
+
+using detail::PhaseTimer;
+
+constexpr std::size_t normal_block = 1024;       // triangles fixed up per batch
+constexpr std::size_t flush_bytes = 1024 * 1024; // bytes buffered before a write
+constexpr std::size_t max_binary_count = std::numeric_limits<std::uint32_t>::max();
+
+} // namespace
+
+struct Writer::State {
+    std::unique_ptr<std::ofstream> file; // set when opened from a path
+    std::ostream* os = nullptr;
+    Format format = Format::ascii;
+    ASCII::detail::TextFormat text;
+    std::uint16_t attribute_byte_count = 0;
+    std::string name;
+    std::optional<std::size_t> count; // announced in the binary header
+    std::streampos start = -1;        // binary: where the header begins
+    std::size_t written = 0;
+    bool finished = false;
+    std::string error; // sticky
+
+    std::vector<Triangle> block; // copy whose missing normals get filled
+    std::string out;             // ASCII text waiting to be written
+    std::vector<std::byte> bytes; // binary records waiting to be written
+
+    explicit State(const SerializeOptions& options) : text(options) {}
+
+    std::unexpected<std::string> fail(std::string message) {
+        error = std::move(message);
+        return std::unexpected(error);
+    }
+
+    bool flush() {
+        const PhaseTimer timer(&Stats::io);
+        detail::count(&Stats::bytes_written, format == Format::ascii ? out.size() : bytes.size());
+        if (format == Format::ascii) {
+            os->write(out.data(), static_cast<std::streamsize>(out.size()));
+            out.clear();
+        } else {
+            Binary::write_exact(*os, bytes);
+            bytes.clear();
+        }
+        return static_cast<bool>(*os);
+    }
+
+    void encode(std::span<const Triangle> tris) {
+        const PhaseTimer timer(&Stats::encode);
+        if (format == Format::ascii) {
+            text.facets(out, tris);
+            return;
+        }
+        const std::size_t old = bytes.size();
+        bytes.resize(old + tris.size() * Binary::record_size);
+        for (std::size_t i = 0; i < tris.size(); ++i)
+            Binary::encode_record(tris[i], attribute_byte_count, bytes.data() + old + i * Binary::record_size);
+    }
+
+    // Header count once the total is known; the write position is kept
+    bool patch_count() {
+        const auto end = os->tellp();
+        std::byte le[4];
+        Binary::store_le<std::uint32_t>(static_cast<std::uint32_t>(written), std::span<std::byte, 4>(le));
+        os->seekp(start + static_cast<std::streamoff>(Binary::header_size));
+        Binary::write_exact(*os, le);
+        os->seekp(end);
+        return static_cast<bool>(*os);
+    }
+};
+
+Writer::Writer(std::unique_ptr<State> state) noexcept : state_(std::move(state)) {}
+Writer::Writer(Writer&& other) noexcept = default;
+Writer& Writer::operator=(Writer&& other) noexcept = default;
+Writer::~Writer() = default;
+
+std::expected<Writer, std::string>
+Writer::open(std::ostream& os, Format format, std::string_view name,
+             std::optional<std::size_t> count, const SerializeOptions& options,
+             std::uint16_t attribute_byte_count) {
+    auto state = std::make_unique<State>(options);
+    state->os = &os;
+    state->format = format;
+    state->name.assign(name);
+    state->count = count;
+    state->attribute_byte_count = attribute_byte_count;
+
+    if (format == Format::ascii) {
+        state->text.begin_solid(state->out, state->name);
+        return Writer(std::move(state));
+    }
+
+    if (count && *count > max_binary_count)
+        return std::unexpected(std::format("Binary STL: {} triangles do not fit the 32-bit count", *count));
+    state->start = os.tellp();
+    if (!count && state->start == std::streampos(-1))
+        return std::unexpected(std::string("Binary STL: triangle count unknown and the stream is not seekable"));
+    std::byte prefix[Binary::prefix_size] = {};
+    std::copy_n(reinterpret_cast<const std::byte*>(name.data()), std::min(name.size(), Binary::header_size), prefix);
+    Binary::store_le<std::uint32_t>(static_cast<std::uint32_t>(count.value_or(0)),
+                                    std::span<std::byte, 4>(prefix + Binary::header_size, 4));
+    detail::count(&Stats::bytes_written, sizeof prefix);
+    if (!Binary::write_exact(os, prefix)) return std::unexpected(std::string("I/O error while writing stream"));
+    return Writer(std::move(state));
+}
+
+std::expected<Writer, std::string>
+Writer::open(const std::filesystem::path& path, Format format, std::string_view name,
+             std::optional<std::size_t> count, const SerializeOptions& options,
+             std::uint16_t attribute_byte_count) {
+    auto file = std::make_unique<std::ofstream>(path, std::ios::binary | std::ios::trunc);
+    if (!*file) return std::unexpected(std::format("Cannot open '{}' for writing", path.string()));
+    auto writer = open(*file, format, name, count, options, attribute_byte_count);
+    if (writer) writer->state_->file = std::move(file);
+    return writer;
+}
+
+std::expected<void, std::string> Writer::write(std::span<const Triangle> tris) {
+    State& s = *state_;
+    if (!s.error.empty()) return std::unexpected(s.error);
+    if (s.finished) return s.fail("Writer: write() after finish()");
+    if (s.format == Format::binary) {
+        const std::size_t limit = s.count.value_or(max_binary_count);
+        if (tris.size() > limit - s.written)
+            return s.fail(std::format("Binary STL: more than {} triangles written", limit));
+    }
+
+    s.block.resize(std::min(tris.size(), normal_block));
+    for (std::size_t first = 0; first < tris.size(); first += s.block.size()) {
+        const std::size_t n = std::min(s.block.size(), tris.size() - first);
+        std::copy_n(tris.begin() + static_cast<std::ptrdiff_t>(first), n, s.block.begin());
+        {
+            // If normal is zero, compute one to keep exporters/readers happy
+            const PhaseTimer timer(&Stats::normals);
+            detail::count(&Stats::normals_computed, fill_missing_normals(std::span<Triangle>(s.block.data(), n)));
+        }
+        s.encode(std::span<const Triangle>(s.block.data(), n));
+        s.written += n;
+        const std::size_t pending = s.format == Format::ascii ? s.out.size() : s.bytes.size();
+        if (pending >= flush_bytes && !s.flush()) return s.fail("I/O error while writing stream");
+    }
+    return {};
+}
+
+std::expected<void, std::string> Writer::finish() {
+    State& s = *state_;
+    if (!s.error.empty()) return std::unexpected(s.error);
+    if (s.finished) return {};
+    s.finished = true;
+    if (s.format == Format::ascii) s.text.end_solid(s.out, s.name);
+    if (!s.flush()) return s.fail("I/O error while writing stream");
+    if (s.format == Format::binary) {
+        if (s.count && *s.count != s.written)
+            return s.fail(std::format("Binary STL: header announced {} triangles, {} were written",
+                                      *s.count, s.written));
+        if (!s.count && !s.patch_count()) return s.fail("Binary STL: cannot update the triangle count");
+    }
+    s.os->flush();
+    if (!*s.os) return s.fail("I/O error while writing stream");
+    return {};
+}
+
+Format Writer::format() const noexcept { return state_->format; }
+
+std::size_t Writer::written() const noexcept { return state_->written; }
+
+} // namespace Harmony::STL
@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+// Shared test fixtures: small synthetic meshes whose geometry is easy to
+// check after a round trip.
+
+#pragma once
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "Harmony/STL/Mesh.h"
+
+/// Unit cube: 8 corners, 12 faces, outward winding; normals are left zero
+inline Harmony::STL::Mesh make_cube() {
+    using Harmony::STL::Vec3;
+    const Vec3 c[8] = {
+        {0,0,0},{1,0,0},{1,1,0},{0,1,0},
+        {0,0,1},{1,0,1},{1,1,1},{0,1,1}
+    };
+    const int f[12][3] = {
+        {0,2,1},{0,3,2}, {4,5,6},{4,6,7},
+        {0,1,5},{0,5,4}, {1,2,6},{1,6,5},
+        {2,3,7},{2,7,6}, {3,0,4},{3,4,7}
+    };
+    Harmony::STL::Mesh m;
+    m.name = "cube";
+    for (auto& face : f) {
+        Harmony::STL::Triangle t{};
+        t.v = { c[face[0]], c[face[1]], c[face[2]] };
+        m.tris.push_back(t);
+    }
+    return m;
+}
+
+/// `n` (> 4) random triangles in [-50, 50]^3; every third normal is zero
+/// and the rest (0,0,7), and triangle 4 is degenerate. Pick an odd `n` so
+/// every normal kernel runs its scalar tail as well.
+inline Harmony::STL::Mesh random_mesh(std::size_t n, unsigned seed = 42) {
+    using Harmony::STL::Vec3;
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> d(-50.0f, 50.0f);
+    Harmony::STL::Mesh m;
+    m.tris.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (auto& p : m.tris[i].v) p = Vec3{d(rng), d(rng), d(rng)};
+        m.tris[i].normal = (i % 3 == 0) ? Vec3{} : Vec3{0, 0, 7};
+    }
+    m.tris[4].v[2] = m.tris[4].v[0]; // degenerate: zero length stays zero
+    return m;
+}
+
+/// `n` triangles, triangle i being (x,0,0) (x,1,0) (x,0,1) with
+/// x = i * step; normals are left zero
+inline Harmony::STL::Mesh make_mesh(std::size_t n, std::string name = "mesh", float step = 1.0f) {
+    using Harmony::STL::Vec3;
+    Harmony::STL::Mesh m;
+    m.name = std::move(name);
+    m.tris.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const float f = static_cast<float>(i) * step;
+        m.tris[i].v = { Vec3{f, 0, 0}, Vec3{f, 1, 0}, Vec3{f, 0, 1} };
+    }
+    return m;
+}
+
+/// Give every triangle `normal` except each `missing_every`-th (from 0)
+inline Harmony::STL::Mesh with_normals(Harmony::STL::Mesh m, const Harmony::STL::Vec3& normal,
+                                       std::size_t missing_every) {
+    for (std::size_t i = 0; i < m.tris.size(); ++i)
+        m.tris[i].normal = i % missing_every ? normal : Harmony::STL::Vec3{};
+    return m;
+}
@@ -13,11 +13,15 @@
 
 #include <fstream>
 #include <sstream>
+#include <charconv>
 #include <cstdio>
+#include <cstring>
 #include <filesystem>
+#include <random>
 
 #include <Harmony/STL/Ascii.h>
 #include <Harmony/STL/Mesh.h>
+#include "TestMesh.h"
 
 using Catch::Matchers::ContainsSubstring;
 using Catch::Matchers::WithinAbs;
@@ -167,6 +171,40 @@ TEST_CASE("Serialize precision control") {
     REQUIRE_THAT(s1, ContainsSubstring("0.1"));
 }
 
+TEST_CASE("Serialize shortest round-trip floats and chunked streaming") {
+    Mesh m;
+    m.name = "rt";
+    for (int i = 0; i < 12000; ++i) { // several 1 MiB stream flushes at precision 9
+        Triangle t{};
+        t.v[0] = {0.1f * float(i), -1.0e-7f, 3.4e37f};
+        t.v[1] = {1.0f / 3.0f, float(i), -0.0f};
+        t.v[2] = {2.5e-40f, 7.0f, 1.0f / float(i + 1)};
+        t.normal = {0, 0, 1};
+        m.tris.push_back(t);
+    }
+
+    Harmony::STL::SerializeOptions shortest;
+    shortest.shortest_round_trip = true;
+    const std::string s = serialize(m, shortest);
+    REQUIRE_THAT(s, ContainsSubstring("vertex 0.33333334 0 -0\n"));
+    auto r = parse(std::string_view{s});
+    REQUIRE(r.has_value());
+    REQUIRE(r->tris.size() == m.tris.size());
+    for (size_t i = 0; i < m.tris.size(); ++i)
+        for (size_t k = 0; k < 3; ++k) {
+            REQUIRE(r->tris[i].v[k].x == m.tris[i].v[k].x);
+            REQUIRE(r->tris[i].v[k].y == m.tris[i].v[k].y);
+            REQUIRE(r->tris[i].v[k].z == m.tris[i].v[k].z);
+        }
+
+    Harmony::STL::SerializeOptions fixed9;
+    fixed9.float_precision = 9;
+    std::ostringstream os;
+    REQUIRE(serialize(os, m, fixed9));
+    REQUIRE(os.str() == serialize(m, 9));
+    REQUIRE(os.str().size() > 2 * 1024 * 1024);
+}
+
 TEST_CASE("Stream parsing from std::istream") {
     std::stringstream ss;
     ss << "solid s\n"
@@ -299,3 +337,198 @@ TEST_CASE("Serializer computes normals if zero before writing") {
     REQUIRE_THAT(s, ContainsSubstring("facet normal 0.000000 0.000000 1.000000"));
 }
 
+TEST_CASE("CRLF line endings, tabs and extra tokens are tolerated") {
+    const std::string txt =
+        "solid  crlf\t name \r\n"
+        "facet normal 0 0 1 ignored\r\n"
+        "\touter loop\r\n"
+        "\t\tvertex 0 0 0\r\n"
+        "\t\tvertex 1 0 0\r\n"
+        "\t\tvertex 0 1 0\r\n"
+        "\tendloop\r\n"
+        "endfacet\r\n"
+        "endsolid\r\n"
+        "trailing garbage after endsolid is ignored\r\n";
+    auto r = parse(std::string_view{txt});
+    REQUIRE(r.has_value());
+    REQUIRE(r->name == "crlf name");
+    REQUIRE(r->tris.size() == 1);
+    check_vec3(r->tris[0].v[1], {1,0,0});
+}
+
+TEST_CASE("Error messages carry the offending line number") {
+    const char* txt = "solid s\n"
+                      "\n"
+                      "  facet normal 0 0 1\n"
+                      "    outer loop\n"
+                      "      vertex 0 0\n";
+    auto r = parse(std::string_view{txt});
+    REQUIRE_FALSE(r.has_value());
+    REQUIRE(r.error() == "Line 5: Expected three floats");
+
+    auto r2 = parse(std::string_view{"solid s\n  facet normal 0 0 1\n  facet normal 0 0 1\n"});
+    REQUIRE_FALSE(r2.has_value());
+    REQUIRE(r2.error() == "Line 3: 'facet' where not expected");
+
+    auto r3 = parse(std::string_view{"solid s\n  facet normal 0 0 1\n"});
+    REQUIRE_FALSE(r3.has_value());
+    REQUIRE_THAT(r3.error(), ContainsSubstring("unterminated facet/loop"));
+}
+
+static Mesh make_big_mesh(std::size_t n) { return with_normals(make_mesh(n, "big"), Vec3{0, 0, 1}, 2); }
+
+static void require_same(const std::expected<Mesh, std::string>& a, const std::expected<Mesh, std::string>& b) {
+    REQUIRE(a.has_value() == b.has_value());
+    if (!a) {
+        REQUIRE(a.error() == b.error());
+        return;
+    }
+    REQUIRE(a->name == b->name);
+    REQUIRE(a->tris.size() == b->tris.size());
+    for (std::size_t i = 0; i < a->tris.size(); ++i) {
+        REQUIRE(a->tris[i].v[0].x == b->tris[i].v[0].x);
+        REQUIRE(a->tris[i].normal.z == b->tris[i].normal.z);
+    }
+}
+
+TEST_CASE("Parallel chunked parse matches the serial parser") {
+    const std::string txt = serialize(make_big_mesh(20000), 6);
+    REQUIRE(txt.size() > 2 * 1024 * 1024);
+    Harmony::STL::ParseOptions opts;
+    opts.threads = 4;
+
+    SECTION("well-formed input") {
+        auto serial = parse(std::string_view{txt});
+        auto par = parse(std::string_view{txt}, opts);
+        REQUIRE(par.has_value());
+        REQUIRE(par->tris.size() == 20000);
+        REQUIRE(par->tris[12345].v[0].x == 12345.0f);
+        require_same(par, serial);
+    }
+
+    SECTION("errors keep the serial message and line number") {
+        std::string bad = txt;
+        const auto pos = bad.find("vertex", bad.size() / 2);
+        bad.replace(pos, 6, "vortex");
+        auto serial = parse(std::string_view{bad});
+        REQUIRE_FALSE(serial.has_value());
+        require_same(parse(std::string_view{bad}, opts), serial);
+    }
+
+    SECTION("facet left open at a chunk boundary") {
+        std::string bad = txt;
+        const auto pos = bad.find("  endfacet\n", bad.size() / 3);
+        bad.erase(pos, 11);
+        auto serial = parse(std::string_view{bad});
+        REQUIRE_FALSE(serial.has_value());
+        require_same(parse(std::string_view{bad}, opts), serial);
+    }
+
+    SECTION("endsolid in the middle stops parsing; later names are ignored") {
+        std::string mid = txt;
+        const auto pos = mid.find("  facet", mid.size() / 2);
+        mid.insert(pos, "endsolid big\nsolid other\n");
+        auto serial = parse(std::string_view{mid});
+        REQUIRE(serial.has_value());
+        REQUIRE(serial->tris.size() < 20000);
+        require_same(parse(std::string_view{mid}, opts), serial);
+    }
+
+    SECTION("a repeated 'solid' line late in the file renames the mesh") {
+        std::string renamed = txt;
+        const auto pos = renamed.find("  facet", renamed.size() - 1000);
+        renamed.insert(pos, "solid renamed part\n");
+        auto par = parse(std::string_view{renamed}, opts);
+        REQUIRE(par.has_value());
+        REQUIRE(par->name == "renamed part");
+        require_same(par, parse(std::string_view{renamed}));
+    }
+}
+
+TEST_CASE("Multi-threaded serialize is byte-identical to the serial writer") {
+    const Mesh m = make_big_mesh(70000); // several 16Ki-facet slices
+    Harmony::STL::SerializeOptions serial, threaded;
+    threaded.threads = 4;
+    for (bool shortest : {false, true}) {
+        serial.shortest_round_trip = threaded.shortest_round_trip = shortest;
+        const std::string ref = serialize(m, serial);
+        REQUIRE(serialize(m, threaded) == ref);
+
+        std::ostringstream os;
+        REQUIRE(serialize(os, m, threaded));
+        REQUIRE(os.str() == ref);
+    }
+}
+
+TEST_CASE("count_facets counts whole-word endfacet keywords") {
+    REQUIRE(count_facets("") == 0);
+    REQUIRE(count_facets("endfacet") == 1);
+    REQUIRE(count_facets("  EndFacet\r\n endfacet") == 2);
+    REQUIRE(count_facets("endfacets xendfacet facet endfacet_") == 0);
+
+    const Mesh m = make_big_mesh(1234);
+    const std::string txt = serialize(m);
+    REQUIRE(count_facets(txt) == 1234);
+    // Every alignment and tail length through the vector loop
+    const std::string_view tail = std::string_view{txt}.substr(txt.size() - 40);
+    for (size_t cut = 0; cut <= tail.size(); ++cut) {
+        const std::string_view sv = tail.substr(cut % 17, tail.size() - cut);
+        size_t expected = 0;
+        for (auto pos = sv.find("endfacet\n"); pos != std::string_view::npos; pos = sv.find("endfacet\n", pos + 1))
+            if (pos == 0 || sv[pos - 1] == ' ') ++expected;
+        if (sv.size() >= 8 && sv.substr(sv.size() - 8) == "endfacet") ++expected;
+        REQUIRE(count_facets(sv) == expected);
+    }
+
+    auto r = parse(std::string_view{txt});
+    REQUIRE(r.has_value());
+    REQUIRE(r->tris.capacity() == 1234); // reserved up front, never regrown
+}
+
+TEST_CASE("Vertex coordinates parse bit-identically to std::from_chars") {
+    // Fixed, scientific and shortest spellings, long digit runs, leading
+    // zeros and signed zeros; all of them go through the fast path or fall
+    // back, and either way must give the from_chars float
+    std::mt19937 rng(1234);
+    std::vector<std::string> tokens = {"0", "-0", "0.0", "-0.000", "000123.5", "1.", ".5", "-.25",
+                                       "1e5", "1E-5", "2.5e+10", "3.4028235e38", "1.17549435e-38",
+                                       "0.1000000000000000055511151231257827", "12345678901234567890",
+                                       "16777217", "33554435", "1.00000005960464477539"};
+    char buf[64];
+    for (int i = 0; i < 3000; ++i) {
+        const auto bits = static_cast<std::uint32_t>(rng());
+        float f;
+        std::memcpy(&f, &bits, sizeof f);
+        if (f != f || f - f != 0.0f) continue; // NaN / inf have their own cases
+        std::snprintf(buf, sizeof buf, "%.*e", static_cast<int>(rng() % 10), static_cast<double>(f));
+        tokens.push_back(buf);
+        std::snprintf(buf, sizeof buf, "%.*f", static_cast<int>(rng() % 12),
+                      std::uniform_real_distribution<double>(-1e4, 1e4)(rng));
+        tokens.push_back(buf);
+        const auto end = std::to_chars(buf, buf + sizeof buf, f).ptr;
+        tokens.emplace_back(buf, end);
+    }
+    while (tokens.size() % 9) tokens.push_back("1");
+
+    std::string txt = "solid numbers\n";
+    for (size_t i = 0; i < tokens.size(); i += 9) {
+        txt += "facet normal 0 0 0\nouter loop\n";
+        for (size_t k = 0; k < 9; k += 3)
+            txt += "vertex " + tokens[i + k] + " " + tokens[i + k + 1] + "\t" + tokens[i + k + 2] + "\r\n";
+        txt += "endloop\nendfacet\n";
+    }
+    txt += "endsolid numbers\n";
+
+    auto r = parse(std::string_view{txt}, false);
+    REQUIRE(r.has_value());
+    REQUIRE(r->tris.size() * 9 == tokens.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        float want = 0;
+        const auto& t = tokens[i];
+        REQUIRE(std::from_chars(t.data(), t.data() + t.size(), want).ec == std::errc{});
+        const Vec3& v = r->tris[i / 9].v[(i % 9) / 3];
+        const float got = (i % 3 == 0) ? v.x : (i % 3 == 1) ? v.y : v.z;
+        INFO(t);
+        REQUIRE(std::memcmp(&got, &want, sizeof got) == 0);
+    }
+}
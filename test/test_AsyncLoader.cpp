@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "Harmony/STL/Ascii.h"
+#include "Harmony/STL/AsyncLoader.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Parse.h"
+#include "TestMesh.h"
+
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+using Catch::Matchers::ContainsSubstring;
+
+using Harmony::STL::AsyncLoader;
+using Harmony::STL::LoadResult;
+using Harmony::STL::Mesh;
+using Harmony::STL::Vec3;
+
+// Every third file is ASCII, the rest binary; returns the paths written
+static std::vector<fs::path> write_files(std::size_t count) {
+    std::vector<fs::path> paths;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Mesh m = make_mesh(100 + i * 37, "part" + std::to_string(i));
+        const fs::path path = fs::temp_directory_path() / ("harmony_async_" + std::to_string(i) + ".stl");
+        std::ofstream os(path, std::ios::binary);
+        if (i % 3 == 0) os << Harmony::STL::ASCII::serialize(m);
+        else REQUIRE(Harmony::STL::Binary::serialize(os, m, m.name));
+        paths.push_back(path);
+    }
+    return paths;
+}
+
+static void check_results(std::vector<std::future<LoadResult>>& futures) {
+    for (std::size_t i = 0; i < futures.size(); ++i) {
+        const LoadResult r = futures[i].get();
+        REQUIRE(r.has_value());
+        REQUIRE(r->name == "part" + std::to_string(i));
+        REQUIRE(r->tris.size() == 100 + i * 37);
+        REQUIRE(r->tris.back().v[0].x == static_cast<float>(r->tris.size() - 1));
+        REQUIRE(r->tris.front().normal.x == 1.0f);
+    }
+}
+
+TEST_CASE("AsyncLoader: batches of mixed-format files") {
+    const auto paths = write_files(24);
+
+    SECTION("default configuration") {
+        AsyncLoader loader;
+        std::vector<std::future<LoadResult>> futures;
+        for (const auto& p : paths) futures.push_back(loader.load_async(p));
+        check_results(futures);
+        REQUIRE(loader.buffered_bytes() == 0);
+    }
+
+    SECTION("tiny read-ahead budget and several I/O threads") {
+        AsyncLoader::Config config;
+        config.io_threads = 3;
+        config.parse_threads = 2;
+        config.max_buffered_bytes = 1; // one file in flight at a time
+        AsyncLoader loader(config);
+        std::vector<std::future<LoadResult>> futures;
+        for (const auto& p : paths) futures.push_back(loader.load_async(p));
+        check_results(futures);
+    }
+
+    SECTION("the destructor completes queued requests") {
+        std::vector<std::future<LoadResult>> futures;
+        {
+            AsyncLoader::Config config;
+            config.parse_threads = 1;
+            AsyncLoader loader(config);
+            for (const auto& p : paths) futures.push_back(loader.load_async(p));
+        }
+        for (auto& f : futures)
+            REQUIRE(f.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        check_results(futures);
+    }
+
+    for (const auto& p : paths) fs::remove(p);
+}
+
+TEST_CASE("AsyncLoader: errors are delivered through the future") {
+    const fs::path bad = fs::temp_directory_path() / "harmony_async_bad.stl";
+    {
+        std::ofstream os(bad, std::ios::binary);
+        os << "solid x\n  facet normal 0 0 1\n    outer loop\n      vertex 0 0\n";
+    }
+    const fs::path missing = fs::temp_directory_path() / "harmony_async_missing.stl";
+    fs::remove(missing);
+
+    AsyncLoader loader;
+    auto a = loader.load_async(missing);
+    auto b = loader.load_async(bad);
+    auto ra = a.get();
+    REQUIRE_FALSE(ra.has_value());
+    REQUIRE_THAT(ra.error(), ContainsSubstring("Cannot open"));
+    auto rb = b.get();
+    REQUIRE_FALSE(rb.has_value());
+    REQUIRE_THAT(rb.error(), ContainsSubstring("Line 4"));
+    fs::remove(bad);
+
+    auto once = Harmony::STL::load_async(missing).get();
+    REQUIRE_FALSE(once.has_value());
+}
+
+TEST_CASE("load_many: results in input order, large files split across the pool") {
+    auto paths = write_files(24);
+    // One ASCII and one binary file above the parsers' split thresholds
+    for (const char* ext : {"_big_ascii.stl", "_big_binary.stl"}) {
+        const Mesh m = make_mesh(200000, ext);
+        const fs::path path = fs::temp_directory_path() / (std::string("harmony_async") + ext);
+        std::ofstream os(path, std::ios::binary);
+        if (ext[5] == 'a') os << Harmony::STL::ASCII::serialize(m);
+        else REQUIRE(Harmony::STL::Binary::serialize(os, m, m.name));
+        paths.insert(paths.begin() + 5, path);
+    }
+    paths.push_back(fs::temp_directory_path() / "harmony_async_missing.stl");
+
+    for (unsigned threads : {1u, 4u}) {
+        Harmony::STL::LoadManyOptions options;
+        options.threads = threads;
+        const auto results = Harmony::STL::load_many(paths, options);
+        REQUIRE(results.size() == paths.size());
+        for (std::size_t i = 0; i + 1 < paths.size(); ++i) {
+            const auto want = Harmony::STL::load(paths[i]);
+            REQUIRE(results[i].has_value());
+            REQUIRE(results[i]->name == want->name);
+            REQUIRE(results[i]->tris.size() == want->tris.size());
+            REQUIRE(results[i]->tris.back().v[0].x == want->tris.back().v[0].x);
+            REQUIRE(results[i]->tris.front().normal.x == 1.0f);
+        }
+        REQUIRE_FALSE(results.back().has_value());
+        REQUIRE_THAT(results.back().error(), ContainsSubstring("Cannot open"));
+    }
+    REQUIRE(Harmony::STL::load_many({}).empty());
+    for (const auto& p : paths) fs::remove(p);
+}
+
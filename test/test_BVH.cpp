@@ -0,0 +1,265 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "Harmony/STL/BVH.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Cache.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace fs = std::filesystem;
+using Harmony::STL::BVH;
+using Harmony::STL::Mesh;
+using Harmony::STL::Ray;
+using Harmony::STL::Triangle;
+using Harmony::STL::Vec3;
+
+// Small random triangles scattered through a cube, plus a few large ones
+static Mesh make_soup(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> pos(-10.0f, 10.0f), off(-0.6f, 0.6f);
+    Mesh m;
+    for (std::size_t i = 0; i < n; ++i) {
+        const float s = i % 97 == 0 ? 8.0f : 1.0f;
+        const Vec3 c{pos(rng), pos(rng), pos(rng)};
+        Triangle t{};
+        for (auto& v : t.v) v = Vec3{c.x + s * off(rng), c.y + s * off(rng), c.z + s * off(rng)};
+        m.tris.push_back(t);
+    }
+    return m;
+}
+
+static Vec3 sub(const Vec3& a, const Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+static Vec3 cross(const Vec3& a, const Vec3& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+static float dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+// Same test as the BVH, so the nearest t must agree exactly
+static std::optional<float> brute_hit(const Mesh& m, const Ray& r, std::uint32_t& face) {
+    std::optional<float> best;
+    for (std::size_t i = 0; i < m.tris.size(); ++i) {
+        const auto& v = m.tris[i].v;
+        const Vec3 e1 = sub(v[1], v[0]), e2 = sub(v[2], v[0]);
+        const Vec3 p = cross(r.direction, e2);
+        const float det = dot(e1, p);
+        if (det == 0.0f) continue;
+        const float inv = 1.0f / det;
+        const Vec3 s = sub(r.origin, v[0]);
+        const float u = dot(s, p) * inv;
+        if (!(u >= 0.0f && u <= 1.0f)) continue;
+        const Vec3 q = cross(s, e1);
+        const float w = dot(r.direction, q) * inv;
+        if (!(w >= 0.0f && u + w <= 1.0f)) continue;
+        const float t = dot(e2, q) * inv;
+        if (t > r.tmin && t < r.tmax && (!best || t < *best)) { best = t; face = static_cast<std::uint32_t>(i); }
+    }
+    return best;
+}
+
+static std::vector<Ray> make_rays(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> pos(-12.0f, 12.0f), dir(-1.0f, 1.0f);
+    std::vector<Ray> rays(n);
+    for (auto& r : rays) {
+        r.origin = Vec3{pos(rng), pos(rng), pos(rng)};
+        r.direction = Vec3{dir(rng), dir(rng), dir(rng)};
+    }
+    rays[0].direction = Vec3{0, 0, 1}; // axis-aligned: infinite inverse components
+    return rays;
+}
+
+TEST_CASE("BVH: ray queries agree with brute force, serial and parallel builds") {
+    const Mesh m = make_soup(3000, 7);
+    BVH::BuildOptions parallel;
+    parallel.threads = 4;
+    for (const BVH& bvh : {BVH::build(m.tris), BVH::build(m.tris, parallel),
+                           BVH::build(Harmony::STL::to_soa(m))}) {
+        REQUIRE(bvh.size() == 3000);
+        REQUIRE(bvh.nodes().size() > 1);
+        for (const Ray& r : make_rays(400, 11)) {
+            std::uint32_t face = 0;
+            const auto expect = brute_hit(m, r, face);
+            const auto hit = bvh.intersect(r);
+            REQUIRE(hit.has_value() == expect.has_value());
+            REQUIRE(bvh.occluded(r) == expect.has_value());
+            if (!expect) continue;
+            REQUIRE(hit->t == *expect);
+            REQUIRE(hit->face == face);
+
+            Ray shorter = r;
+            shorter.tmax = *expect; // the nearest hit itself is excluded
+            REQUIRE(bvh.intersect(shorter).has_value() == bvh.occluded(shorter));
+        }
+    }
+
+    const BVH none = BVH::build(std::span<const Triangle>{});
+    REQUIRE(none.empty());
+    REQUIRE_FALSE(none.intersect(Ray{}).has_value());
+}
+
+TEST_CASE("BVH: box and closest-point queries agree with brute force") {
+    const Mesh m = make_soup(2000, 3);
+    const BVH bvh = BVH::build(Harmony::STL::weld(m, 0.0f, false));
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> pos(-11.0f, 11.0f), half(0.1f, 3.0f);
+    for (int q = 0; q < 100; ++q) {
+        const Vec3 c{pos(rng), pos(rng), pos(rng)};
+        const float h = half(rng);
+        const Harmony::STL::Box box{Vec3{c.x - h, c.y - h, c.z - h}, Vec3{c.x + h, c.y + h, c.z + h}};
+        std::vector<std::uint32_t> got;
+        bvh.query(box, got);
+        std::sort(got.begin(), got.end());
+
+        std::vector<std::uint32_t> want;
+        float nearest = std::numeric_limits<float>::infinity();
+        for (std::size_t i = 0; i < m.tris.size(); ++i) {
+            const auto& v = m.tris[i].v;
+            const auto lo = [&](auto f) { return std::min({f(v[0]), f(v[1]), f(v[2])}); };
+            const auto hi = [&](auto f) { return std::max({f(v[0]), f(v[1]), f(v[2])}); };
+            const auto x = [](const Vec3& p) { return p.x; };
+            const auto y = [](const Vec3& p) { return p.y; };
+            const auto z = [](const Vec3& p) { return p.z; };
+            if (lo(x) <= box.max.x && hi(x) >= box.min.x && lo(y) <= box.max.y && hi(y) >= box.min.y
+                && lo(z) <= box.max.z && hi(z) >= box.min.z)
+                want.push_back(static_cast<std::uint32_t>(i));
+            // Upper bound on the surface distance: the nearest vertex
+            for (const Vec3& p : v) nearest = std::min(nearest, std::sqrt(dot(sub(p, c), sub(p, c))));
+        }
+        REQUIRE(got == want);
+
+        const auto cp = bvh.closest_point(c);
+        REQUIRE(cp.has_value());
+        REQUIRE(cp->distance <= nearest);
+        REQUIRE(std::fabs(std::sqrt(dot(sub(cp->point, c), sub(cp->point, c))) - cp->distance) < 1e-4f);
+        // No face is nearer than the answer
+        for (std::size_t i = 0; i < m.tris.size(); ++i) {
+            const auto one = BVH::build(std::span<const Triangle>(&m.tris[i], 1)).closest_point(c);
+            REQUIRE(one->distance >= cp->distance - 1e-5f);
+        }
+        REQUIRE_FALSE(bvh.closest_point(c, cp->distance * 0.5f).has_value());
+    }
+}
+
+TEST_CASE("BVH: encode / decode round trip and damaged images") {
+    const Mesh m = make_soup(500, 1);
+    const BVH bvh = BVH::build(m.tris);
+    const auto bytes = bvh.encode();
+    auto back = BVH::decode(bytes);
+    REQUIRE(back.has_value());
+    REQUIRE(back->size() == bvh.size());
+    REQUIRE(back->encode() == bytes);
+    for (const Ray& r : make_rays(50, 2)) {
+        const auto a = bvh.intersect(r), b = back->intersect(r);
+        REQUIRE(a.has_value() == b.has_value());
+        if (a) REQUIRE(a->face == b->face);
+    }
+
+    std::vector<std::byte> truncated(bytes.begin(), bytes.end() - 1);
+    REQUIRE_FALSE(BVH::decode(truncated).has_value());
+    std::vector<std::byte> bad_magic = bytes;
+    bad_magic[0] = std::byte{'X'};
+    REQUIRE(BVH::decode(bad_magic).error() == "BVH: not a Harmony BVH");
+    // Root's first child pointing back at the root would loop forever
+    std::vector<std::byte> cycle = bytes;
+    const std::size_t child0 = 48 + 6 * 16;
+    for (std::size_t k = 0; k < 4; ++k) cycle[child0 + k] = std::byte{0};
+    REQUIRE_FALSE(BVH::decode(cycle).has_value());
+}
+
+// Hand-built image: `levels` inner nodes in a chain, each with three empty
+// inner siblings beside the next link, so a traversal keeps three more
+// entries per level on its stack; the last link holds triangle 0
+static std::vector<std::byte> chain_image(std::size_t levels, bool share = false) {
+    std::vector<std::byte> bytes = BVH::build(make_soup(1, 1).tris).encode();
+    bytes.resize(48);
+    auto put = [&](auto v) {
+        const auto* b = reinterpret_cast<const std::byte*>(&v);
+        bytes.insert(bytes.end(), b, b + sizeof v);
+    };
+    const std::uint32_t node_count = static_cast<std::uint32_t>(1 + 4 * levels);
+    std::memcpy(bytes.data() + 12, &node_count, 4);
+    auto node = [&](std::array<std::uint32_t, 4> child, std::array<std::uint32_t, 4> count) {
+        for (int a = 0; a < 6; ++a)
+            for (int k = 0; k < 4; ++k) put(a < 3 ? -1e30f : 1e30f);
+        for (std::uint32_t c : child) put(c);
+        for (std::uint32_t c : count) put(c);
+    };
+    constexpr std::uint32_t none = BVH::empty_slot;
+    std::uint32_t next = 1;
+    for (std::size_t l = 0; l < levels; ++l, next += 4) {
+        const std::uint32_t sibling = share ? next + 3 : next;
+        node({sibling, next + 1, next + 2, next + 3}, {0, 0, 0, 0});
+        for (int e = 0; e < 3; ++e) node({none, none, none, none}, {0, 0, 0, 0});
+    }
+    node({BVH::leaf_bit, none, none, none}, {1, 0, 0, 0});
+    put(Vec3{0, 0, 0});
+    put(Vec3{1, 0, 0});
+    put(Vec3{0, 1, 0});
+    put(std::uint32_t{0});
+    return bytes;
+}
+
+TEST_CASE("BVH: decode rejects trees the traversal stack cannot hold") {
+    // Shallow enough: decodes and the chain's triangle is found
+    auto shallow = BVH::decode(chain_image(10));
+    REQUIRE(shallow.has_value());
+    Ray down;
+    down.origin = Vec3{0.25f, 0.25f, 1.0f};
+    down.direction = Vec3{0, 0, -1};
+    REQUIRE(shallow->intersect(down).has_value());
+
+    auto deep = BVH::decode(chain_image(200));
+    REQUIRE_FALSE(deep.has_value());
+    REQUIRE_THAT(deep.error(), Catch::Matchers::ContainsSubstring("deeper than"));
+
+    auto shared = BVH::decode(chain_image(3, true));
+    REQUIRE_FALSE(shared.has_value());
+    REQUIRE_THAT(shared.error(), Catch::Matchers::ContainsSubstring("more than one parent"));
+}
+
+TEST_CASE("BVH: load_cached_with_bvh reuses the sidecar until the source changes") {
+    const fs::path dir = fs::temp_directory_path() / "harmony_bvh_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir);
+    const fs::path source = dir / "soup.stl";
+    auto write_source = [&](const Mesh& m) {
+        std::ofstream os(source, std::ios::binary | std::ios::trunc);
+        REQUIRE(Harmony::STL::Binary::serialize(os, m, "soup"));
+    };
+
+    write_source(make_soup(300, 9));
+    auto first = Harmony::STL::load_cached_with_bvh(source);
+    REQUIRE(first.has_value());
+    REQUIRE(first->bvh.size() == 300);
+    fs::path sidecar = Harmony::STL::cache_path(source);
+    sidecar += ".bvh";
+    REQUIRE(fs::exists(sidecar));
+
+    auto again = Harmony::STL::load_cached_with_bvh(source);
+    REQUIRE(again.has_value());
+    REQUIRE(again->bvh.encode() == first->bvh.encode());
+
+    write_source(make_soup(120, 4));
+    auto changed = Harmony::STL::load_cached_with_bvh(source);
+    REQUIRE(changed.has_value());
+    REQUIRE(changed->mesh.tris.size() == 120);
+    REQUIRE(changed->bvh.size() == 120);
+    fs::remove_all(dir, ec);
+}
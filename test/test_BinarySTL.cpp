@@ -15,15 +15,22 @@
 #include "Harmony/STL/Parse.h"
 #include "Harmony/STL/Binary.h"
 #include "Harmony/STL/Mesh.h"
+#include "TestMesh.h"
 
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <vector>
 #include <cstring>
+#include <algorithm>
+#include <memory_resource>
+#include <ranges>
 
 namespace fs = std::filesystem;
 
+using Catch::Matchers::ContainsSubstring;
+using Catch::Matchers::WithinAbs;
+
 using namespace Harmony::STL::Binary;
 
 using Harmony::STL::Mesh;
@@ -105,7 +112,7 @@ TEST_CASE("Binary STL: writer computes normal if zero") {
 TEST_CASE("Binary STL: file I/O round-trip with non-zero attribute bytes") {
     Mesh m;
     m.name = "attr";
-    HSTL::Triangle t{};
+    Triangle t{};
     t.v[0] = {0,0,0};
     t.v[1] = {0,1,0};
     t.v[2] = {0,0,1};
@@ -240,3 +247,447 @@ TEST_CASE("Binary STL: large mesh reserve and precision tolerance") {
     // float tolerance example
     REQUIRE_THAT(r->tris[10].v[0].x, WithinAbs(10.0f, 1e-6f));
 }
+
+TEST_CASE("Binary STL: parse from a contiguous buffer") {
+    Mesh m;
+    for (int i=0;i<5;++i) {
+        Triangle t{};
+        t.v[0] = {float(i), 0, 0};
+        t.v[1] = {float(i), 1, 0};
+        t.v[2] = {float(i), 0, 1};
+        t.normal = (i % 2) ? Vec3{1,0,0} : Vec3{0,0,0};
+        m.tris.push_back(t);
+    }
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+    REQUIRE(serialize(ss, m, "buffer"));
+    const std::string bytes = ss.str();
+    REQUIRE(bytes.size() == 84 + 50 * 5);
+
+    auto r = parse(std::string_view{bytes});
+    REQUIRE(r.has_value());
+    REQUIRE(r->name == "buffer");
+    REQUIRE(r->tris.size() == 5);
+    check_vec3(r->tris[4].v[1], {4,1,0});
+    check_vec3(r->tris[1].normal, {1,0,0});
+
+    SECTION("truncated buffers are rejected before allocating") {
+        auto r1 = parse(std::string_view{bytes}.substr(0, 40));
+        REQUIRE_FALSE(r1.has_value());
+        REQUIRE_THAT(r1.error(), ContainsSubstring("80-byte header"));
+
+        auto r2 = parse(std::string_view{bytes}.substr(0, 82));
+        REQUIRE_FALSE(r2.has_value());
+        REQUIRE_THAT(r2.error(), ContainsSubstring("triangle count"));
+
+        auto r3 = parse(std::string_view{bytes}.substr(0, bytes.size() - 1));
+        REQUIRE_FALSE(r3.has_value());
+        REQUIRE_THAT(r3.error(), ContainsSubstring("unexpected EOF in triangle data"));
+    }
+
+    SECTION("stream and buffer parsers agree") {
+        std::stringstream in(bytes, std::ios::in | std::ios::binary);
+        auto rs = parse(in, false);
+        auto rb = parse(std::string_view{bytes}, false);
+        REQUIRE(rs.has_value());
+        REQUIRE(rb.has_value());
+        REQUIRE(rs->tris.size() == rb->tris.size());
+        REQUIRE(std::memcmp(rs->tris.data(), rb->tris.data(), rs->tris.size() * sizeof(Triangle)) == 0);
+    }
+}
+
+TEST_CASE("Binary STL: memory-mapped load from file") {
+    Mesh m;
+    Triangle t{};
+    t.v[0] = {0,0,0};
+    t.v[1] = {1,0,0};
+    t.v[2] = {0,1,0};
+    m.tris.push_back(t);
+
+    const auto tmp = fs::temp_directory_path() / "harmony_bin_stl_mmap.stl";
+    {
+        std::ofstream out(tmp, std::ios::binary);
+        REQUIRE(serialize(out, m, "mapped"));
+    }
+    auto r = load(tmp);
+    REQUIRE(r.has_value());
+    REQUIRE(r->name == "mapped");
+    REQUIRE(r->tris.size() == 1);
+    check_vec3(r->tris[0].normal, {0,0,1});
+
+    std::error_code ec;
+    fs::remove(tmp, ec);
+
+    auto missing = load(tmp);
+    REQUIRE_FALSE(missing.has_value());
+    REQUIRE_THAT(missing.error(), ContainsSubstring("Cannot open"));
+}
+
+TEST_CASE("Binary STL: lazy View over a buffer") {
+    static_assert(std::ranges::random_access_range<View>);
+    static_assert(std::ranges::sized_range<View>);
+    static_assert(std::ranges::view<View>);
+
+    Mesh m;
+    for (int i=0;i<16;++i) {
+        Triangle t{};
+        t.v[0] = {float(i), 0, 0};
+        t.v[1] = {float(i), 1, 0};
+        t.v[2] = {float(i), 0, -1};
+        t.normal = {0,1,0};
+        m.tris.push_back(t);
+    }
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+    REQUIRE(serialize(ss, m, "view", /*attr*/7));
+    const std::string bytes = ss.str();
+
+    auto v = View::open(bytes);
+    REQUIRE(v.has_value());
+    REQUIRE(v->size() == 16);
+    REQUIRE(v->name() == "view");
+    REQUIRE(v->attribute(3) == 7);
+    check_vec3((*v)[9].v[0], {9,0,0});
+    check_vec3(v->begin()[15].v[2], {15,0,-1});
+    REQUIRE(std::ranges::distance(*v) == 16);
+
+    // Single pass without materialising a Mesh
+    const auto maxX = std::ranges::max(*v | std::views::transform([](const Triangle& t){ return t.v[0].x; }));
+    REQUIRE(maxX == 15.0f);
+    auto it = std::ranges::find_if(*v, [](const Triangle& t){ return t.v[0].x == 4.0f; });
+    REQUIRE(it - v->begin() == 4);
+
+    auto bad = View::open(std::string_view{bytes}.substr(0, 84 + 50 * 15));
+    REQUIRE_FALSE(bad.has_value());
+    REQUIRE_THAT(bad.error(), ContainsSubstring("unexpected EOF in triangle data"));
+}
+
+TEST_CASE("Binary STL: default-constructed View is empty") {
+    const View v;
+    REQUIRE(v.size() == 0);
+    REQUIRE(v.empty());
+    REQUIRE(v.begin() == v.end());
+    REQUIRE(std::ranges::distance(v) == 0);
+    std::size_t seen = 0;
+    for (const Triangle& t : v) seen += t.v.size();
+    REQUIRE(seen == 0);
+    REQUIRE(std::ranges::find_if(v, [](const Triangle&) { return true; }) == v.end());
+    REQUIRE(std::ranges::all_of(v.header(), [](std::byte b) { return b == std::byte{0}; }));
+    REQUIRE(v.name().empty());
+}
+
+TEST_CASE("Binary STL: multi-threaded decode and encode match the serial path") {
+    constexpr std::size_t N = 300000; // several 64Ki-record slices
+    const Mesh m = with_normals(make_mesh(N, "threaded"), Vec3{0, 1, 0}, 3);
+
+    std::ostringstream serial(std::ios::binary), threaded(std::ios::binary);
+    REQUIRE(serialize(serial, m, "threaded", 7));
+    REQUIRE(serialize(threaded, m, Harmony::STL::SerializeOptions{.threads = 4}, "threaded", 7));
+    const std::string bytes = serial.str();
+    REQUIRE(threaded.str() == bytes);
+
+    auto ref = parse(std::string_view{bytes});
+    auto par = Harmony::STL::Binary::parse(std::string_view{bytes}, Harmony::STL::ParseOptions{.threads = 4});
+    REQUIRE(ref.has_value());
+    REQUIRE(par.has_value());
+    REQUIRE(par->name == "threaded");
+    REQUIRE(par->tris.size() == N);
+    REQUIRE(std::memcmp(par->tris.data(), ref->tris.data(), N * sizeof(Triangle)) == 0);
+    check_vec3(par->tris[N - 1].v[0], {float(N - 1), 0, 0});
+    check_vec3(par->tris[3].normal, {1, 0, 0});
+
+    auto truncated = Harmony::STL::Binary::parse(std::string_view{bytes}.substr(0, bytes.size() - 1),
+                                                 Harmony::STL::ParseOptions{.threads = 4});
+    REQUIRE_FALSE(truncated.has_value());
+    REQUIRE_THAT(truncated.error(), ContainsSubstring("unexpected EOF"));
+}
+
+TEST_CASE("Binary STL: parse_range decodes just a slice") {
+    Mesh m;
+    for (int i = 0; i < 40; ++i) {
+        Triangle t{};
+        t.v = { Vec3{float(i), 0, 0}, Vec3{float(i), 1, 0}, Vec3{float(i), 0, 1} };
+        m.tris.push_back(t);
+    }
+    const std::vector<std::byte> bytes = serialize(m, "ranged");
+    const std::string_view text(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+
+    auto mid = parse_range(text, 10, 5);
+    REQUIRE(mid.has_value());
+    REQUIRE(mid->name == "ranged");
+    REQUIRE(mid->tris.size() == 5);
+    check_vec3(mid->tris[0].v[0], {10, 0, 0});
+    check_vec3(mid->tris[4].normal, {1, 0, 0}); // missing normals are filled
+
+    REQUIRE(parse_range(text, 38, 100)->tris.size() == 2); // clipped
+    REQUIRE(parse_range(text, 400, 1)->tris.empty());
+    REQUIRE_FALSE(parse_range(text.substr(0, text.size() - 1), 0, 1).has_value());
+
+    const auto tmp = fs::temp_directory_path() / "harmony_bin_stl_range.stl";
+    {
+        std::ofstream out(tmp, std::ios::binary);
+        REQUIRE(serialize(out, m, "ranged"));
+    }
+    auto from_file = parse_range(tmp, 39, 1);
+    REQUIRE(from_file.has_value());
+    check_vec3(from_file->tris[0].v[1], {39, 1, 0});
+    std::error_code ec;
+    fs::remove(tmp, ec);
+    REQUIRE_THAT(parse_range(tmp, 0, 1).error(), ContainsSubstring("Cannot open"));
+}
+
+TEST_CASE("Binary STL: per-face attribute words survive a round trip") {
+    constexpr std::size_t N = 140001; // threaded decode and encode take the slice paths
+    Mesh m = make_mesh(N, "");
+    m.attributes.resize(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        m.attributes[i] = Harmony::STL::Binary::encode_color({std::uint8_t(i % 32), std::uint8_t(i / 32 % 32), 7});
+    }
+    m.attributes[5] = 0; // no colour
+
+    const std::vector<std::byte> bytes = serialize(m, "colours", 99);
+    const std::string_view text(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    REQUIRE(View::open(text)->attribute(6) == m.attributes[6]);
+    REQUIRE(View::open(text)->attribute(5) == 0); // per-face words win over the single one
+
+    for (unsigned threads : {1u, 4u}) {
+        Harmony::STL::ParseOptions options;
+        options.threads = threads;
+        options.keep_attributes = true;
+        auto back = Harmony::STL::Binary::parse(text, options);
+        REQUIRE(back.has_value());
+        REQUIRE(back->attributes == m.attributes);
+        REQUIRE(Harmony::STL::Binary::serialize(*back, "colours", 99, Harmony::STL::SerializeOptions{.threads = threads})
+                == bytes);
+    }
+    const auto color = Harmony::STL::Binary::decode_color(m.attributes[33]);
+    REQUIRE(color.has_value());
+    REQUIRE(*color == Harmony::STL::Binary::Color{1, 1, 7});
+    REQUIRE_FALSE(Harmony::STL::Binary::decode_color(m.attributes[5]).has_value());
+
+    auto range = parse_range(text, 40, 3, Harmony::STL::ParseOptions{.keep_attributes = true});
+    REQUIRE(range->attributes == std::vector<std::uint16_t>(m.attributes.begin() + 40, m.attributes.begin() + 43));
+
+    // Not kept unless asked for, and cleared when a reused mesh is parsed again
+    Mesh reused;
+    REQUIRE(Harmony::STL::Binary::parse_into(text, reused, Harmony::STL::ParseOptions{.keep_attributes = true}));
+    REQUIRE(reused.attributes.size() == N);
+    REQUIRE(Harmony::STL::Binary::parse_into(text, reused));
+    REQUIRE(reused.attributes.empty());
+    REQUIRE(Harmony::STL::Binary::parse(text, true)->attributes.empty());
+}
+
+TEST_CASE("Binary STL: in-memory serializers match the stream writer") {
+    Mesh m;
+    m.name = "mem";
+    for (int i = 0; i < 50000; ++i) { // spans several write blocks
+        Triangle t{};
+        t.v[0] = {float(i), 0, 0};
+        t.v[1] = {float(i), 1, 0};
+        t.v[2] = {float(i), 0, 1};
+        t.normal = (i % 2) ? Vec3{0, 1, 0} : Vec3{0, 0, 0};
+        m.tris.push_back(t);
+    }
+    std::ostringstream os(std::ios::binary);
+    REQUIRE(serialize(os, m, "in-memory", 3));
+    const std::string ref = os.str();
+    REQUIRE(ref.size() == serialized_size(m));
+    REQUIRE(serialized_size(0) == prefix_size);
+
+    const std::vector<std::byte> bytes = serialize(m, "in-memory", 3);
+    REQUIRE(bytes.size() == ref.size());
+    REQUIRE(std::memcmp(bytes.data(), ref.data(), ref.size()) == 0);
+
+    std::vector<std::byte> buf(ref.size() + 16, std::byte{0xAB});
+    auto written = serialize(std::span<std::byte>(buf), m, "in-memory", 3);
+    REQUIRE(written.has_value());
+    REQUIRE(*written == ref.size());
+    REQUIRE(std::memcmp(buf.data(), ref.data(), ref.size()) == 0);
+    REQUIRE(buf.back() == std::byte{0xAB});
+
+    std::vector<std::byte> small(ref.size() - 1);
+    auto too_small = serialize(std::span<std::byte>(small), m);
+    REQUIRE_FALSE(too_small.has_value());
+    REQUIRE_THAT(too_small.error(), ContainsSubstring("too small"));
+
+    View view = View::open(ref).value();
+    REQUIRE(view.attribute(49999) == 3);
+    check_vec3(view[0].normal, {1, 0, 0});
+}
+
+namespace {
+// Read-only stream buffer without seek support (like a pipe)
+struct NoSeekBuf : std::streambuf {
+    explicit NoSeekBuf(std::string& s) { setg(s.data(), s.data(), s.data() + s.size()); }
+};
+} // namespace
+
+TEST_CASE("Binary STL: buffer-based format detection") {
+    using Harmony::STL::Format;
+    using Harmony::STL::detect_format;
+
+    Mesh m;
+    Triangle t{};
+    t.v[0] = {0,0,0}; t.v[1] = {1,0,0}; t.v[2] = {0,1,0};
+    for (int i = 0; i < 4; ++i) m.tris.push_back(t);
+    std::ostringstream os(std::ios::binary);
+    // Binary files whose header starts with "solid" are common in the wild
+    REQUIRE(serialize(os, m, "solid exported by a CAD tool", 0));
+    std::string bytes = os.str();
+
+    REQUIRE(detect_format(bytes) == Format::binary);
+    REQUIRE(detect_format("solid x\n  facet normal 0 0 1\n") == Format::ascii);
+    REQUIRE(detect_format("  SOLID\nendsolid\n") == Format::ascii);
+    REQUIRE(detect_format("solidity") == Format::binary);
+    REQUIRE(detect_format("") == Format::binary);
+
+    auto r = Harmony::STL::parse(std::string_view{bytes});
+    REQUIRE(r.has_value());
+    REQUIRE(r->tris.size() == 4);
+    REQUIRE(r->name == "solid exported by a CAD tool");
+
+    // Seekable stream: the size check decides
+    std::istringstream seekable(bytes, std::ios::binary);
+    auto rs = Harmony::STL::parse(seekable);
+    REQUIRE(rs.has_value());
+    REQUIRE(rs->tris.size() == 4);
+
+    // Non-seekable: the NUL padding after "solid ..." gives it away
+    NoSeekBuf buf(bytes);
+    std::istream pipe(&buf);
+    auto rp = Harmony::STL::parse(pipe);
+    REQUIRE(rp.has_value());
+    REQUIRE(rp->tris.size() == 4);
+
+    // ASCII with a bare "solid" line goes to the ASCII parser
+    std::string text = "solid\nfacet normal 0 0 1\nouter loop\nvertex 0 0 0\nvertex 1 0 0\n"
+                       "vertex 0 1 0\nendloop\nendfacet\nendsolid\n";
+    NoSeekBuf tbuf(text);
+    std::istream tpipe(&tbuf);
+    auto ra = Harmony::STL::parse(tpipe);
+    REQUIRE(ra.has_value());
+    REQUIRE(ra->tris.size() == 1);
+
+    const fs::path path = fs::temp_directory_path() / "harmony_detect_test.stl";
+    {
+        std::ofstream f(path, std::ios::binary);
+        f.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    auto rl = Harmony::STL::load(path);
+    REQUIRE(rl.has_value());
+    REQUIRE(rl->tris.size() == 4);
+    fs::remove(path);
+}
+
+TEST_CASE("Binary STL: parse many parts into one pmr arena") {
+    Mesh m;
+    Triangle t{};
+    t.v[0] = {0,0,0}; t.v[1] = {1,0,0}; t.v[2] = {0,1,0};
+    for (int i = 0; i < 3; ++i) m.tris.push_back(t);
+    std::ostringstream os(std::ios::binary);
+    REQUIRE(serialize(os, m, "a part whose name is longer than SSO"));
+    const std::string bin = os.str();
+    const std::string text = Harmony::STL::ASCII::serialize(m);
+
+    // Every byte must come from the arena: the upstream refuses to allocate
+    std::vector<std::byte> storage(256 * 1024);
+    std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size(),
+                                              std::pmr::null_memory_resource());
+    std::pmr::vector<Harmony::STL::pmr::Mesh> parts(&arena);
+    for (int i = 0; i < 20; ++i) {
+        auto r = Harmony::STL::parse(std::string_view{i % 2 ? bin : text}, &arena);
+        REQUIRE(r.has_value());
+        REQUIRE(r->get_allocator().resource() == &arena);
+        parts.push_back(std::move(*r));
+    }
+    REQUIRE(parts.size() == 20);
+    REQUIRE(parts[1].name == "a part whose name is longer than SSO");
+    REQUIRE(parts[0].tris.size() == 3);
+    check_vec3(parts[19].tris[2].normal, {0,0,1});
+
+    auto bad = Harmony::STL::Binary::parse(std::string_view{bin}.substr(0, 90), &arena);
+    REQUIRE_FALSE(bad.has_value());
+}
+
+namespace {
+// Reads like a pipe: no seeking
+struct UnseekableBuf : std::streambuf {
+    explicit UnseekableBuf(std::string bytes) : data(std::move(bytes)) {
+        setg(data.data(), data.data(), data.data() + data.size());
+    }
+    std::string data;
+};
+} // namespace
+
+TEST_CASE("Binary STL: header counts are checked before they are trusted with memory") {
+    Mesh m;
+    m.tris.resize(3);
+    std::ostringstream os(std::ios::binary);
+    REQUIRE(serialize(os, m, "claims"));
+    std::string bytes = os.str();
+    // Claim 4 billion triangles over the three records present
+    for (std::size_t k = 0; k < 4; ++k) bytes[80 + k] = static_cast<char>(0xee);
+
+    SECTION("seekable stream: rejected from its size") {
+        std::istringstream is(bytes, std::ios::binary);
+        auto r = parse(is);
+        REQUIRE_FALSE(r.has_value());
+        REQUIRE(r.error() == "Binary STL: unexpected EOF in triangle data");
+    }
+
+    SECTION("unseekable stream: fails at EOF without reserving the count") {
+        UnseekableBuf buf(bytes);
+        std::istream is(&buf);
+        REQUIRE_FALSE(remaining_bytes(is).has_value());
+        auto r = parse(is);
+        REQUIRE_FALSE(r.has_value());
+        REQUIRE(r.error() == "Binary STL: unexpected EOF in triangle data");
+
+        UnseekableBuf good(os.str());
+        std::istream gs(&good);
+        auto ok = parse(gs);
+        REQUIRE(ok.has_value());
+        REQUIRE(ok->tris.size() == 3);
+    }
+
+    SECTION("remaining_bytes leaves the stream where it was") {
+        std::istringstream is(bytes, std::ios::binary);
+        is.seekg(10);
+        REQUIRE(remaining_bytes(is) == bytes.size() - 10);
+        REQUIRE(is.tellg() == std::streampos(10));
+        REQUIRE(is.good());
+    }
+}
+
+TEST_CASE("Binary STL: memory_limit refuses meshes that would not fit") {
+    Mesh m;
+    m.tris.resize(1000);
+    for (std::size_t i = 0; i < m.tris.size(); ++i) m.tris[i].v[1] = Vec3{static_cast<float>(i), 1, 0};
+    std::ostringstream os(std::ios::binary);
+    REQUIRE(serialize(os, m, "budget"));
+    const std::string bytes = os.str();
+    const std::string text = Harmony::STL::ASCII::serialize(m);
+
+    Harmony::STL::ParseOptions options;
+    options.memory_limit = 1000 * sizeof(Triangle);
+    options.threads = 4;
+    REQUIRE(Harmony::STL::Binary::parse(std::string_view{bytes}, options).has_value());
+    REQUIRE(Harmony::STL::ASCII::parse(text, options).has_value());
+
+    options.memory_limit -= 1;
+    Mesh reused = m;
+    auto r = Harmony::STL::Binary::parse_into(std::string_view{bytes}, reused, options);
+    REQUIRE_FALSE(r.has_value());
+    REQUIRE(r.error() == "Binary STL: 1000 triangles need 48000 bytes, over the 47999-byte memory limit");
+    REQUIRE(reused.tris.empty());
+    auto a = Harmony::STL::parse(std::string_view{text}, options);
+    REQUIRE_FALSE(a.has_value());
+    REQUIRE(a.error() == "1000 facets need 48000 bytes, over the 47999-byte memory limit");
+
+    // Attribute words count too; a range only needs room for itself
+    options.memory_limit = 1000 * sizeof(Triangle);
+    options.keep_attributes = true;
+    REQUIRE_FALSE(Harmony::STL::Binary::parse(std::string_view{bytes}, options).has_value());
+    auto part = Harmony::STL::Binary::parse_range(std::string_view{bytes}, 100, 500, options);
+    REQUIRE(part.has_value());
+    REQUIRE(part->tris.size() == 500);
+}
+
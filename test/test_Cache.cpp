@@ -0,0 +1,249 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Cache.h"
+#include "Harmony/STL/IndexedMesh.h"
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+using Harmony::STL::CacheOptions;
+using Harmony::STL::IndexedMesh;
+using Harmony::STL::Mesh;
+using Harmony::STL::Vec3;
+
+// Folded strip: shared vertices and normals in every octant
+static Mesh make_strip(std::size_t n) {
+    Mesh m;
+    m.name = "strip";
+    for (std::size_t i = 0; i < n; ++i) {
+        const float x = static_cast<float>(i) * 0.25f - 10.0f;
+        const float z = (i % 2) ? 1.5f : -2.0f;
+        Harmony::STL::Triangle t{};
+        t.v = { Vec3{x, 0, z}, Vec3{x + 0.25f, 0, -z}, Vec3{x, 3.0f, z * 0.5f} };
+        t.normal = Harmony::STL::face_normal(t);
+        m.tris.push_back(t);
+    }
+    return m;
+}
+
+static bool same(const Vec3& a, const Vec3& b) { return std::memcmp(&a, &b, sizeof(Vec3)) == 0; }
+
+TEST_CASE("Cache: lossless round trip over many blocks") {
+    const IndexedMesh im = Harmony::STL::weld(make_strip(1000), 0.0f, true);
+    CacheOptions options;
+    options.block_items = 64;
+    options.threads = 4;
+    options.codec = Harmony::STL::CacheCodec::none;
+    auto raw = Harmony::STL::encode_cache(im, options);
+    REQUIRE(raw.has_value());
+
+    auto info = Harmony::STL::cache_info(*raw);
+    REQUIRE(info.has_value());
+    REQUIRE(info->vertex_count == im.vertices.size());
+    REQUIRE(info->face_count == 1000);
+    REQUIRE(info->has_normals);
+    REQUIRE(info->min.x == -10.0f);
+    REQUIRE(info->max.y == 3.0f);
+
+    for (auto codec : {Harmony::STL::CacheCodec::none, Harmony::STL::CacheCodec::lz4, Harmony::STL::CacheCodec::zstd}) {
+        options.codec = codec;
+        auto bytes = Harmony::STL::encode_cache(im, options);
+        REQUIRE(bytes.has_value());
+        if (codec != Harmony::STL::CacheCodec::none && Harmony::STL::codec_available(codec))
+            REQUIRE(bytes->size() < raw->size());
+        else
+            REQUIRE(*bytes == *raw); // unavailable codecs store blocks raw
+
+        auto back = Harmony::STL::decode_cache(*bytes, 4);
+        REQUIRE(back.has_value());
+        REQUIRE(back->name == "strip");
+        REQUIRE(back->indices == im.indices);
+        REQUIRE(back->vertices.size() == im.vertices.size());
+        for (std::size_t i = 0; i < im.vertices.size(); ++i) REQUIRE(same(back->vertices[i], im.vertices[i]));
+        for (std::size_t i = 0; i < im.normals.size(); ++i) REQUIRE(same(back->normals[i], im.normals[i]));
+    }
+}
+
+TEST_CASE("Cache: quantised positions and oct-encoded normals") {
+    const IndexedMesh im = Harmony::STL::weld(make_strip(300), 0.0f, true);
+    CacheOptions options;
+    options.quantize_positions = true;
+    options.oct_normals = true;
+    auto bytes = Harmony::STL::encode_cache(im, options);
+    REQUIRE(bytes.has_value());
+    auto back = Harmony::STL::decode_cache(*bytes);
+    REQUIRE(back.has_value());
+
+    const float step = 85.0f / 65535.0f; // widest extent over the 16-bit grid
+    for (std::size_t i = 0; i < im.vertices.size(); ++i) {
+        REQUIRE(std::fabs(back->vertices[i].x - im.vertices[i].x) <= step);
+        REQUIRE(std::fabs(back->vertices[i].y - im.vertices[i].y) <= step);
+        REQUIRE(std::fabs(back->vertices[i].z - im.vertices[i].z) <= step);
+    }
+    for (std::size_t i = 0; i < im.normals.size(); ++i) {
+        const Vec3& a = im.normals[i];
+        const Vec3& b = back->normals[i];
+        REQUIRE(a.x * b.x + a.y * b.y + a.z * b.z > 0.99999f);
+    }
+
+    // Degenerate (zero) normals survive as zero
+    IndexedMesh flat = im;
+    flat.normals[0] = Vec3{};
+    auto zero = Harmony::STL::decode_cache(*Harmony::STL::encode_cache(flat, options));
+    REQUIRE(zero.has_value());
+    REQUIRE(same(zero->normals[0], Vec3{}));
+}
+
+TEST_CASE("Cache: damaged files are rejected") {
+    const IndexedMesh im = Harmony::STL::weld(make_strip(100), 0.0f, true);
+    auto bytes = Harmony::STL::encode_cache(im);
+    REQUIRE(bytes.has_value());
+
+    std::vector<std::byte> truncated(bytes->begin(), bytes->end() - 1);
+    REQUIRE_FALSE(Harmony::STL::decode_cache(truncated).has_value());
+
+    std::vector<std::byte> bad_magic = *bytes;
+    bad_magic[0] = std::byte{'X'};
+    const auto e = Harmony::STL::decode_cache(bad_magic);
+    REQUIRE_FALSE(e.has_value());
+    REQUIRE(e.error() == "Mesh cache: not a Harmony mesh cache");
+
+    IndexedMesh broken = im;
+    broken.indices[5][1] = static_cast<std::uint32_t>(im.vertices.size());
+    REQUIRE_FALSE(Harmony::STL::encode_cache(broken).has_value());
+}
+
+TEST_CASE("Cache: compressed blocks too small for their raw size are rejected") {
+    using Harmony::STL::CacheCodec;
+    const IndexedMesh im = Harmony::STL::weld(make_strip(2000), 0.0f, true);
+    for (CacheCodec codec : {CacheCodec::lz4, CacheCodec::zstd}) {
+        if (!Harmony::STL::codec_available(codec)) continue;
+        CacheOptions options;
+        options.codec = codec;
+        auto bytes = Harmony::STL::encode_cache(im, options);
+        REQUIRE(bytes.has_value());
+        // First table entry (after the 96-byte header and the name): claim 1 stored byte
+        std::vector<std::byte> tiny = *bytes;
+        const std::size_t entry = 96 + im.name.size();
+        REQUIRE(static_cast<CacheCodec>(tiny[entry + 1]) == codec);
+        const std::uint32_t one = 1;
+        for (std::size_t k = 0; k < 4; ++k) tiny[entry + 4 + k] = static_cast<std::byte>(one >> (8 * k));
+        const auto r = Harmony::STL::decode_cache(tiny);
+        REQUIRE_FALSE(r.has_value());
+        REQUIRE(r.error().find("too few") != std::string::npos);
+    }
+}
+
+TEST_CASE("Cache: load_cached misses when the options differ from the cache's") {
+    const fs::path dir = fs::temp_directory_path() / "harmony_cache_options_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir);
+    const fs::path source = dir / "part.stl";
+    {
+        std::ofstream os(source, std::ios::binary | std::ios::trunc);
+        REQUIRE(Harmony::STL::Binary::serialize(os, make_strip(150), "strip"));
+    }
+    const auto exact = Harmony::STL::Binary::load(source);
+    REQUIRE(exact.has_value());
+    auto lossless = [&](const Mesh& m) {
+        REQUIRE(m.tris.size() == exact->tris.size());
+        for (std::size_t i = 0; i < m.tris.size(); ++i)
+            for (std::size_t k = 0; k < 3; ++k) REQUIRE(same(m.tris[i].v[k], exact->tris[i].v[k]));
+    };
+
+    CacheOptions lossy;
+    lossy.quantize_positions = true;
+    lossy.oct_normals = true;
+    REQUIRE(Harmony::STL::load_cached(source, lossy).has_value());
+
+    // The lossless caller gets the exact mesh, and the cache is rebuilt for it
+    auto plain = Harmony::STL::load_cached(source, CacheOptions{});
+    REQUIRE(plain.has_value());
+    lossless(*plain);
+
+    CacheOptions welded;
+    welded.weld_epsilon = 1e-3f;
+    REQUIRE(Harmony::STL::load_cached(source, welded).has_value());
+    CacheOptions raw_normals;
+    raw_normals.parse.compute_missing_normals = false;
+    REQUIRE(Harmony::STL::load_cached(source, raw_normals).has_value());
+    std::ifstream is(Harmony::STL::cache_path(source), std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(is)), {});
+    const auto key = Harmony::STL::cache_info(std::as_bytes(std::span(bytes)));
+    REQUIRE(key.has_value());
+    REQUIRE_FALSE(key->compute_missing_normals);
+    REQUIRE(key->weld_epsilon == 0.0f);
+
+    auto back = Harmony::STL::load_cached(source, CacheOptions{});
+    REQUIRE(back.has_value());
+    lossless(*back);
+    fs::remove_all(dir, ec);
+}
+
+TEST_CASE("Cache: load_cached builds, reuses and rebuilds the cache") {
+    const fs::path dir = fs::temp_directory_path() / "harmony_cache_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir);
+    const fs::path source = dir / "part.stl";
+    auto write_source = [&](const Mesh& m) {
+        std::ofstream os(source, std::ios::binary | std::ios::trunc);
+        REQUIRE(Harmony::STL::Binary::serialize(os, m, m.name));
+    };
+
+    const Mesh original = make_strip(500);
+    write_source(original);
+    CacheOptions options;
+    options.directory = dir / "caches";
+    const fs::path cache = Harmony::STL::cache_path(source, options);
+    REQUIRE(cache.parent_path() == dir / "caches");
+
+    auto first = Harmony::STL::load_cached(source, options);
+    REQUIRE(first.has_value());
+    REQUIRE(first->tris.size() == 500);
+    REQUIRE(fs::exists(cache));
+
+    // A hit decodes the cache without looking at the source contents: plant
+    // a different mesh under the same key and it comes back
+    REQUIRE(Harmony::STL::load_cache(cache).has_value());
+    {
+        std::ifstream is(cache, std::ios::binary);
+        std::vector<char> raw((std::istreambuf_iterator<char>(is)), {});
+        auto key = Harmony::STL::cache_info(std::as_bytes(std::span(raw)));
+        REQUIRE(key.has_value());
+        auto planted = Harmony::STL::encode_cache(Harmony::STL::weld(make_strip(7), 0.0f, true), {}, *key);
+        REQUIRE(planted.has_value());
+        std::ofstream os(cache, std::ios::binary | std::ios::trunc);
+        os.write(reinterpret_cast<const char*>(planted->data()), static_cast<std::streamsize>(planted->size()));
+    }
+    auto hit = Harmony::STL::load_cached(source, options);
+    REQUIRE(hit.has_value());
+    REQUIRE(hit->tris.size() == 7);
+
+    // A modified source invalidates it
+    write_source(make_strip(40));
+    auto rebuilt = Harmony::STL::load_cached(source, options);
+    REQUIRE(rebuilt.has_value());
+    REQUIRE(rebuilt->tris.size() == 40);
+    auto again = Harmony::STL::load_cached(source, options);
+    REQUIRE(again.has_value());
+    REQUIRE(again->tris.size() == 40);
+    for (std::size_t i = 0; i < 40; ++i)
+        for (std::size_t k = 0; k < 3; ++k) REQUIRE(same(again->tris[i].v[k], rebuilt->tris[i].v[k]));
+
+    REQUIRE_FALSE(Harmony::STL::load_cached(dir / "missing.stl", options).has_value());
+    fs::remove_all(dir, ec);
+}
@@ -0,0 +1,188 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "Harmony/STL/Ascii.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Convert.h"
+#include "Harmony/STL/Writer.h"
+#include "TestMesh.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+namespace fs = std::filesystem;
+
+using Catch::Matchers::ContainsSubstring;
+
+using Harmony::STL::Format;
+using Harmony::STL::Mesh;
+using Harmony::STL::SerializeOptions;
+using Harmony::STL::Triangle;
+using Harmony::STL::Vec3;
+using Harmony::STL::Writer;
+
+// Odd triangles carry a normal, even ones need theirs computed
+static Mesh part_mesh(std::size_t n) {
+    return with_normals(make_mesh(n, "converted part", 0.25f), Vec3{0, 0, 1}, 2);
+}
+
+static std::string binary_bytes(const Mesh& m) {
+    std::ostringstream os(std::ios::binary);
+    REQUIRE(Harmony::STL::Binary::serialize(os, m, m.name));
+    return os.str();
+}
+
+// Accepts writes but cannot seek, like a pipe
+struct PipeBuf : std::streambuf {
+    std::string data;
+    int_type overflow(int_type c) override {
+        if (c != traits_type::eof()) data += static_cast<char>(c);
+        return c;
+    }
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        data.append(s, static_cast<std::size_t>(n));
+        return n;
+    }
+};
+
+TEST_CASE("Writer: batches give the bytes of the whole-mesh serializers") {
+    const Mesh m = part_mesh(5000);
+    SerializeOptions options;
+    options.float_precision = 3;
+
+    auto write_in_batches = [&](std::ostream& os, Format format, std::optional<std::size_t> count) {
+        auto w = Writer::open(os, format, m.name, count, options);
+        REQUIRE(w.has_value());
+        const std::span<const Triangle> all(m.tris);
+        for (std::size_t first = 0; first < all.size(); first += 777)
+            REQUIRE(w->write(all.subspan(first, std::min<std::size_t>(777, all.size() - first))).has_value());
+        REQUIRE(w->finish().has_value());
+        REQUIRE(w->written() == m.tris.size());
+    };
+
+    std::ostringstream ascii;
+    write_in_batches(ascii, Format::ascii, std::nullopt);
+    REQUIRE(ascii.str() == Harmony::STL::ASCII::serialize(m, options));
+
+    std::ostringstream counted(std::ios::binary);
+    write_in_batches(counted, Format::binary, m.tris.size());
+    REQUIRE(counted.str() == binary_bytes(m));
+
+    // Count unknown up front: patched into the header at finish()
+    std::stringstream patched(std::ios::in | std::ios::out | std::ios::binary);
+    write_in_batches(patched, Format::binary, std::nullopt);
+    REQUIRE(patched.str() == binary_bytes(m));
+}
+
+TEST_CASE("Writer: binary count errors") {
+    const Mesh m = part_mesh(10);
+
+    std::ostringstream os(std::ios::binary);
+    auto short_write = Writer::open(os, Format::binary, m.name, 11);
+    REQUIRE(short_write.has_value());
+    REQUIRE(short_write->write(m.tris).has_value());
+    auto r = short_write->finish();
+    REQUIRE_FALSE(r.has_value());
+    REQUIRE_THAT(r.error(), ContainsSubstring("announced 11"));
+
+    auto long_write = Writer::open(os, Format::binary, m.name, 5);
+    REQUIRE(long_write.has_value());
+    REQUIRE_FALSE(long_write->write(m.tris).has_value());
+    REQUIRE_FALSE(long_write->finish().has_value()); // sticky
+
+    PipeBuf pipe;
+    std::ostream piped(&pipe);
+    auto unseekable = Writer::open(piped, Format::binary, m.name);
+    REQUIRE_FALSE(unseekable.has_value());
+    REQUIRE_THAT(unseekable.error(), ContainsSubstring("not seekable"));
+    REQUIRE(Writer::open(piped, Format::binary, m.name, 10).has_value());
+}
+
+TEST_CASE("convert: both directions match parse + serialize") {
+    const Mesh m = part_mesh(20000);
+    const std::string text = Harmony::STL::ASCII::serialize(m);
+    const std::string bin = binary_bytes(m);
+
+    SECTION("ascii to binary") {
+        std::istringstream in(text);
+        std::stringstream out(std::ios::in | std::ios::out | std::ios::binary);
+        auto n = Harmony::STL::convert(in, out, Format::binary);
+        REQUIRE(n.has_value());
+        REQUIRE(*n == m.tris.size());
+        REQUIRE(out.str() == bin);
+    }
+
+    SECTION("binary to ascii, through a pipe") {
+        std::istringstream in(bin, std::ios::binary);
+        PipeBuf pipe;
+        std::ostream out(&pipe);
+        REQUIRE(Harmony::STL::convert(in, out, Format::ascii).has_value());
+        REQUIRE(pipe.data == text);
+    }
+
+    SECTION("same format, other options") {
+        SerializeOptions options;
+        options.shortest_round_trip = true;
+        std::istringstream in(text);
+        std::ostringstream out;
+        REQUIRE(Harmony::STL::convert(in, out, Format::ascii, options).has_value());
+        auto parsed = Harmony::STL::ASCII::parse(std::string_view{text});
+        REQUIRE(parsed.has_value());
+        REQUIRE(out.str() == Harmony::STL::ASCII::serialize(*parsed, options));
+    }
+
+    SECTION("ascii to binary needs a seekable output") {
+        std::istringstream in(text);
+        PipeBuf pipe;
+        std::ostream out(&pipe);
+        auto n = Harmony::STL::convert(in, out, Format::binary);
+        REQUIRE_FALSE(n.has_value());
+        REQUIRE_THAT(n.error(), ContainsSubstring("not seekable"));
+    }
+}
+
+TEST_CASE("convert: files and errors") {
+    const fs::path src = fs::temp_directory_path() / "harmony_convert_in.stl";
+    const fs::path dst = fs::temp_directory_path() / "harmony_convert_out.stl";
+    const Mesh m = part_mesh(300);
+    {
+        std::ofstream os(src, std::ios::binary);
+        os << Harmony::STL::ASCII::serialize(m);
+    }
+    auto n = Harmony::STL::convert(src, dst, Format::binary);
+    REQUIRE(n.has_value());
+    REQUIRE(*n == 300);
+    {
+        std::ifstream is(dst, std::ios::binary);
+        std::ostringstream got;
+        got << is.rdbuf();
+        REQUIRE(got.str() == binary_bytes(m));
+    }
+
+    auto same = Harmony::STL::convert(src, src, Format::binary);
+    REQUIRE_FALSE(same.has_value());
+    REQUIRE(fs::file_size(src) > 0); // not truncated
+
+    {
+        std::ofstream os(src, std::ios::binary);
+        os << "solid x\n  facet normal 0 0 1\n    outer loop\n      vertex 0 0\n";
+    }
+    auto bad = Harmony::STL::convert(src, dst, Format::binary);
+    REQUIRE_FALSE(bad.has_value());
+    REQUIRE_THAT(bad.error(), ContainsSubstring("Line 4"));
+
+    fs::remove(src);
+    fs::remove(dst);
+    REQUIRE_FALSE(Harmony::STL::convert(src, dst, Format::ascii).has_value());
+}
@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Harmony/STL/IndexedMesh.h"
+#include "Harmony/STL/Mesh.h"
+#include "TestMesh.h"
+
+#include <algorithm>
+#include <cmath>
+
+using Harmony::STL::IndexedMesh;
+using Harmony::STL::Mesh;
+using Harmony::STL::Triangle;
+using Harmony::STL::Vec3;
+using Harmony::STL::weld;
+using Harmony::STL::expand;
+
+static bool nearly_equal(float a, float b, float eps=1e-5f) {
+    return std::fabs(a-b) <= eps;
+}
+static void check_vec3(const Vec3& a, const Vec3& b, float eps=1e-5f) {
+    REQUIRE(nearly_equal(a.x, b.x, eps));
+    REQUIRE(nearly_equal(a.y, b.y, eps));
+    REQUIRE(nearly_equal(a.z, b.z, eps));
+}
+
+TEST_CASE("IndexedMesh: exact welding of a closed cube") {
+    Mesh m = make_cube();
+    for (auto& t : m.tris) t.normal = Harmony::STL::face_normal(t);
+    const IndexedMesh im = weld(m);
+    REQUIRE(im.name == "cube");
+    REQUIRE(im.vertices.size() == 8);
+    REQUIRE(im.indices.size() == 12);
+    REQUIRE(im.normals.empty());
+
+    const Mesh back = expand(im);
+    REQUIRE(back.tris.size() == m.tris.size());
+    for (std::size_t i = 0; i < m.tris.size(); ++i) {
+        for (std::size_t k = 0; k < 3; ++k) check_vec3(back.tris[i].v[k], m.tris[i].v[k], 0.0f);
+        check_vec3(back.tris[i].normal, m.tris[i].normal);
+    }
+}
+
+TEST_CASE("IndexedMesh: negative zero welds with positive zero") {
+    Mesh m;
+    Triangle a{};
+    a.v = { Vec3{0,0,0}, Vec3{1,0,0}, Vec3{0,1,0} };
+    Triangle b{};
+    b.v = { Vec3{-0.0f,0,0}, Vec3{0,1,0}, Vec3{-1,0,0} };
+    m.tris = {a, b};
+    REQUIRE(weld(m).vertices.size() == 4);
+}
+
+TEST_CASE("IndexedMesh: epsilon grid merges near-coincident vertices") {
+    Mesh m = make_cube();
+    // jitter the second occurrence of every corner slightly
+    for (std::size_t i = 1; i < m.tris.size(); i += 2)
+        for (auto& p : m.tris[i].v) { p.x += 1e-6f; p.z -= 1e-6f; }
+
+    REQUIRE(weld(m).vertices.size() > 8);
+    REQUIRE(weld(m, 1e-3f).vertices.size() == 8);
+}
+
+TEST_CASE("IndexedMesh: normals kept on request and used by expand") {
+    Mesh m = make_cube();
+    m.tris[0].normal = {0,0,-2}; // deliberately unnormalised
+    const IndexedMesh im = weld(m, 0.0f, /*keep_normals*/true);
+    REQUIRE(im.normals.size() == 12);
+    const Mesh back = expand(im);
+    check_vec3(back.tris[0].normal, {0,0,-2});
+}
+
+TEST_CASE("IndexedMesh: welding grows past the initial table size") {
+    // disjoint triangles: three unique vertices per face
+    constexpr int n = 5000;
+    Mesh m;
+    for (int i = 0; i < n; ++i) {
+        Triangle t{};
+        t.v = { Vec3{float(i), 0, 0}, Vec3{float(i), 1, 0}, Vec3{float(i), 0, 1} };
+        m.tris.push_back(t);
+    }
+    const IndexedMesh im = weld(m);
+    REQUIRE(im.vertices.size() == std::size_t(3*n));
+    REQUIRE(im.indices[n-1][2] == std::uint32_t(3*n-1));
+    const Mesh back = expand(im);
+    check_vec3(back.tris[1234].v[1], {1234,1,0}, 0.0f);
+}
+
+TEST_CASE("IndexedMesh: clean removes degenerate and duplicate faces") {
+    Mesh m = make_cube();
+    const Triangle first = m.tris[0];
+    Triangle sliver{};
+    sliver.v = { Vec3{0,0,0}, Vec3{0.5f,0,0}, Vec3{1,0,0} };    // collinear
+    Triangle point{};
+    point.v = { Vec3{1,1,1}, Vec3{1,1,1}, Vec3{0,0,7} };        // repeated vertex, lone corner
+    Triangle rotated = first;
+    rotated.v = { first.v[1], first.v[2], first.v[0] };
+    Triangle flipped = first;
+    flipped.v = { first.v[0], first.v[2], first.v[1] };
+    Triangle near = first;
+    for (auto& p : near.v) p.y += 1e-6f;
+    m.tris.insert(m.tris.begin() + 3, {sliver, rotated, point, flipped, near});
+
+    Harmony::STL::CleanupStats stats;
+    const IndexedMesh exact = Harmony::STL::clean(m, {}, &stats);
+    REQUIRE(stats.degenerate == 2);
+    REQUIRE(stats.duplicates == 2);            // rotated and flipped; `near` differs
+    REQUIRE(stats.unused_vertices == 2);       // {0.5,0,0} and {0,0,7}
+    REQUIRE(exact.indices.size() == 13);
+
+    Harmony::STL::CleanupOptions options;
+    options.weld_epsilon = 1e-3f;
+    options.respect_winding = true;
+    options.keep_normals = true;
+    const IndexedMesh snapped = Harmony::STL::clean(m, options, &stats);
+    REQUIRE(stats.duplicates == 2);            // rotated and near; flipped is kept
+    REQUIRE(snapped.indices.size() == 13);
+    REQUIRE(snapped.vertices.size() == 8);
+    REQUIRE(snapped.normals.size() == 13);
+
+    // Without removals, clean() is weld()
+    options = {};
+    options.remove_degenerate = options.remove_duplicates = false;
+    const IndexedMesh plain = Harmony::STL::clean(m, options);
+    const IndexedMesh welded = weld(m);
+    REQUIRE(plain.indices == welded.indices);
+    REQUIRE(plain.vertices.size() == welded.vertices.size());
+}
+
+TEST_CASE("IndexedMesh: clean is independent of the thread count") {
+    // Every face three times over (rotated, then flipped) on a shared grid
+    Mesh m;
+    for (int i = 0; i < 200; ++i)
+        for (int j = 0; j < 200; ++j) {
+            Triangle t{};
+            t.v = { Vec3{float(i), float(j), 0}, Vec3{float(i+1), float(j), 0}, Vec3{float(i), float(j+1), 0} };
+            m.tris.push_back(t);
+            std::rotate(t.v.begin(), t.v.begin() + 1, t.v.end());
+            m.tris.push_back(t);
+            std::swap(t.v[0], t.v[1]);
+            m.tris.push_back(t);
+        }
+    Harmony::STL::CleanupStats serial_stats, parallel_stats;
+    const IndexedMesh serial = Harmony::STL::clean(m, {}, &serial_stats);
+    Harmony::STL::CleanupOptions options;
+    options.threads = 4;
+    const IndexedMesh parallel = Harmony::STL::clean(m, options, &parallel_stats);
+    REQUIRE(serial_stats.duplicates == 2 * 40000);
+    REQUIRE(parallel_stats.duplicates == serial_stats.duplicates);
+    REQUIRE(serial.indices.size() == 40000);
+    REQUIRE(serial.vertices.size() == 201 * 201 - 1);
+    REQUIRE(parallel.indices == serial.indices);
+    for (std::size_t v = 0; v < serial.vertices.size(); ++v) check_vec3(parallel.vertices[v], serial.vertices[v], 0.0f);
+}
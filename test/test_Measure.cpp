@@ -0,0 +1,164 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "Harmony/STL/Ascii.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Measure.h"
+#include "Harmony/STL/Normals.h"
+#include "Harmony/STL/Reader.h"
+#include "TestMesh.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+using Catch::Matchers::WithinRel;
+
+using Harmony::STL::GeometryStats;
+using Harmony::STL::Mesh;
+using Harmony::STL::MeshSoA;
+using Harmony::STL::Triangle;
+using Harmony::STL::Vec3;
+
+// The shared soup with a second degenerate face
+static Mesh soup(std::size_t n) {
+    Mesh m = random_mesh(n, 7);
+    m.tris[9].v[1] = m.tris[9].v[0];
+    return m;
+}
+
+static GeometryStats reference(const Mesh& m) {
+    GeometryStats g;
+    g.faces = m.tris.size();
+    for (const Triangle& t : m.tris) {
+        for (const Vec3& p : t.v) {
+            g.min = Vec3{std::fmin(g.min.x, p.x), std::fmin(g.min.y, p.y), std::fmin(g.min.z, p.z)};
+            g.max = Vec3{std::fmax(g.max.x, p.x), std::fmax(g.max.y, p.y), std::fmax(g.max.z, p.z)};
+        }
+        const double ax = t.v[0].x, ay = t.v[0].y, az = t.v[0].z;
+        const double e1x = t.v[1].x - ax, e1y = t.v[1].y - ay, e1z = t.v[1].z - az;
+        const double e2x = t.v[2].x - ax, e2y = t.v[2].y - ay, e2z = t.v[2].z - az;
+        const double cx = e1y * e2z - e1z * e2y, cy = e1z * e2x - e1x * e2z, cz = e1x * e2y - e1y * e2x;
+        const double len = std::sqrt(cx * cx + cy * cy + cz * cz);
+        g.area += len / 2;
+        g.volume += (ax * cx + ay * cy + az * cz) / 6;
+        if (len == 0) ++g.degenerate;
+    }
+    return g;
+}
+
+static bool same(const Vec3& a, const Vec3& b) { return std::memcmp(&a, &b, sizeof(Vec3)) == 0; }
+
+static void check_close(const GeometryStats& a, const GeometryStats& b) {
+    REQUIRE(a.faces == b.faces);
+    REQUIRE(a.degenerate == b.degenerate);
+    REQUIRE(same(a.min, b.min));
+    REQUIRE(same(a.max, b.max));
+    REQUIRE_THAT(a.area, WithinRel(b.area, 1e-5));
+    REQUIRE_THAT(a.volume, WithinRel(b.volume, 1e-4));
+}
+
+TEST_CASE("Measure: unit cube") {
+    const Mesh cube = make_cube();
+    const GeometryStats g = Harmony::STL::measure(cube.tris);
+    REQUIRE(g.faces == 12);
+    REQUIRE(g.degenerate == 0);
+    REQUIRE(same(g.min, Vec3{0, 0, 0}));
+    REQUIRE(same(g.max, Vec3{1, 1, 1}));
+    REQUIRE_THAT(g.area, WithinRel(6.0, 1e-12));
+    REQUIRE_THAT(g.volume, WithinRel(1.0, 1e-12));
+    REQUIRE(same(cube.tris[0].normal, Vec3{})); // measure() leaves normals alone
+
+    const GeometryStats none = Harmony::STL::measure(std::span<const Triangle>{});
+    REQUIRE(none.empty());
+    REQUIRE(none.min.x > none.max.x);
+}
+
+TEST_CASE("Measure: fused pass matches the separate loops") {
+    const Mesh ref = soup(1003);
+    Mesh fused = ref;
+    Mesh split = ref;
+    std::size_t filled = 0;
+    const GeometryStats g = Harmony::STL::measure_and_fill_normals(fused.tris, true, &filled);
+    REQUIRE(filled == Harmony::STL::fill_missing_normals(split.tris));
+    for (std::size_t i = 0; i < ref.tris.size(); ++i) REQUIRE(same(fused.tris[i].normal, split.tris[i].normal));
+    check_close(g, reference(ref));
+    REQUIRE(g.degenerate == 2);
+
+    Mesh all = ref;
+    Harmony::STL::measure_and_fill_normals(all.tris, false);
+    Harmony::STL::recompute_normals(split.tris);
+    for (std::size_t i = 0; i < ref.tris.size(); ++i) REQUIRE(same(all.tris[i].normal, split.tris[i].normal));
+
+    MeshSoA soa = Harmony::STL::to_soa(ref);
+    check_close(Harmony::STL::measure_and_fill_normals(soa), g);
+
+    // Batches merge to the whole
+    GeometryStats parts = Harmony::STL::measure(std::span<const Triangle>(ref.tris).first(500));
+    parts.merge(Harmony::STL::measure(std::span<const Triangle>(ref.tris).subspan(500)));
+    check_close(parts, g);
+}
+
+TEST_CASE("Measure: NaN coordinates do not poison the bounds") {
+    Mesh m = make_cube();
+    m.tris[3].v[1].x = std::numeric_limits<float>::quiet_NaN();
+    for (int i = 0; i < 20; ++i) m.tris.push_back(m.tris[i % 12]);
+    const GeometryStats g = Harmony::STL::measure(m.tris);
+    REQUIRE(same(g.min, Vec3{0, 0, 0}));
+    REQUIRE(same(g.max, Vec3{1, 1, 1}));
+    REQUIRE(g.degenerate == 3); // the NaN face and its two copies
+}
+
+TEST_CASE("Measure: parsers and the reader measure while decoding") {
+    const Mesh small = soup(20001);
+    const std::string text = Harmony::STL::ASCII::serialize(small);
+    Mesh parsed_ref = *Harmony::STL::ASCII::parse(std::string_view{text});
+    const GeometryStats text_ref = reference(parsed_ref);
+    for (unsigned threads : {1u, 4u}) {
+        GeometryStats g;
+        Harmony::STL::ParseOptions options;
+        options.threads = threads;
+        options.geometry = &g;
+        auto m = Harmony::STL::ASCII::parse(std::string_view{text}, options);
+        REQUIRE(m.has_value());
+        check_close(g, text_ref);
+    }
+
+    // Large enough for the threaded binary decoder to split it
+    const Mesh big = soup(140001);
+    const GeometryStats expected = reference(big);
+    const auto bytes = Harmony::STL::Binary::serialize(big, "big");
+    const std::string_view view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    for (unsigned threads : {1u, 4u}) {
+        GeometryStats g;
+        Harmony::STL::ParseOptions options;
+        options.threads = threads;
+        options.geometry = &g;
+        REQUIRE(Harmony::STL::Binary::parse(view, options).has_value());
+        check_close(g, expected);
+    }
+
+    std::istringstream is(std::string(view), std::ios::binary);
+    auto reader = Harmony::STL::Reader::open(is);
+    REQUIRE(reader.has_value());
+    reader->measure_geometry();
+    REQUIRE(Harmony::STL::read_mesh(*reader).has_value());
+    check_close(reader->geometry(), expected);
+
+    GeometryStats failed;
+    failed.faces = 99;
+    Harmony::STL::ParseOptions options;
+    options.geometry = &failed;
+    REQUIRE_FALSE(Harmony::STL::ASCII::parse(std::string_view{"solid x\nfacet\n"}, options).has_value());
+    REQUIRE(failed.empty());
+}
@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Harmony/STL/Ascii.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/MeshSoA.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+
+using Harmony::STL::Mesh;
+using Harmony::STL::MeshSoA;
+using Harmony::STL::Triangle;
+using Harmony::STL::Vec3;
+
+static Mesh make_strip(int n) {
+    Mesh m;
+    m.name = "strip";
+    for (int i = 0; i < n; ++i) {
+        Triangle t{};
+        t.v = { Vec3{float(i), 0, 0}, Vec3{float(i) + 1, 0, 0}, Vec3{float(i), 1, 0} };
+        t.normal = (i % 3) ? Vec3{0,0,1} : Vec3{0,0,0};
+        m.tris.push_back(t);
+    }
+    return m;
+}
+
+TEST_CASE("MeshSoA: round trip through to_soa / to_mesh") {
+    const Mesh m = make_strip(37);
+    const MeshSoA soa = Harmony::STL::to_soa(m);
+    REQUIRE(soa.name == "strip");
+    REQUIRE(soa.size() == 37);
+    REQUIRE(soa.v[1].x[5] == 6.0f);
+    REQUIRE(soa.v[2].y[5] == 1.0f);
+    // component arrays are SIMD aligned
+    REQUIRE(reinterpret_cast<std::uintptr_t>(soa.v[0].x.data()) % 64 == 0);
+
+    const Mesh back = Harmony::STL::to_mesh(soa);
+    REQUIRE(back.tris.size() == m.tris.size());
+    for (std::size_t i = 0; i < m.tris.size(); ++i) {
+        REQUIRE(back.tris[i].v[0].x == m.tris[i].v[0].x);
+        REQUIRE(back.tris[i].v[2].y == m.tris[i].v[2].y);
+        REQUIRE(back.tris[i].normal.z == m.tris[i].normal.z);
+    }
+}
+
+TEST_CASE("MeshSoA: binary and ASCII parsers write SoA directly") {
+    const Mesh m = make_strip(10);
+
+    std::stringstream bin(std::ios::in | std::ios::out | std::ios::binary);
+    REQUIRE(Harmony::STL::Binary::serialize(bin, m, "soa"));
+    const std::string bytes = bin.str();
+    const std::string text = Harmony::STL::ASCII::serialize(m);
+
+    auto b = Harmony::STL::Binary::parse_soa(bytes, /*compute_missing_normals*/false);
+    auto a = Harmony::STL::ASCII::parse_soa(text);
+    REQUIRE(b.has_value());
+    REQUIRE(a.has_value());
+    REQUIRE(b->name == "soa");
+    REQUIRE(a->name == "strip");
+    REQUIRE(b->size() == 10);
+    REQUIRE(a->size() == 10);
+    for (std::size_t i = 0; i < 10; ++i) {
+        REQUIRE(b->v[1].x[i] == float(i) + 1);
+        REQUIRE(a->v[1].x[i] == float(i) + 1);
+        // the serializers fill in missing normals on the way out
+        REQUIRE(b->normal.z[i] == 1.0f);
+        REQUIRE(a->normal.z[i] == 1.0f);
+    }
+
+    // zero the first record's normal: recomputed only when requested
+    std::string zeroed = bytes;
+    std::fill_n(zeroed.begin() + 84, 12, '\0');
+    auto keep = Harmony::STL::Binary::parse_soa(zeroed, false);
+    auto fix = Harmony::STL::Binary::parse_soa(zeroed, true);
+    REQUIRE(keep->normal.z[0] == 0.0f);
+    REQUIRE(fix->normal.z[0] == 1.0f);
+
+    auto bad = Harmony::STL::Binary::parse_soa(std::string_view{bytes}.substr(0, 100));
+    REQUIRE_FALSE(bad.has_value());
+}
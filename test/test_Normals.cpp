@@ -0,0 +1,67 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "Harmony/STL/MeshSoA.h"
+#include "Harmony/STL/Normals.h"
+#include "TestMesh.h"
+
+#include <vector>
+
+using Catch::Matchers::WithinAbs;
+
+using Harmony::STL::Mesh;
+using Harmony::STL::MeshSoA;
+using Harmony::STL::Triangle;
+using Harmony::STL::Vec3;
+
+static void check_same(const Vec3& a, const Vec3& b) {
+    REQUIRE_THAT(a.x, WithinAbs(b.x, 1e-6));
+    REQUIRE_THAT(a.y, WithinAbs(b.y, 1e-6));
+    REQUIRE_THAT(a.z, WithinAbs(b.z, 1e-6));
+}
+
+TEST_CASE("Normals: a kernel is selected") {
+    REQUIRE_FALSE(Harmony::STL::normals_kernel().empty());
+}
+
+TEST_CASE("Normals: batch recompute matches face_normal") {
+    Mesh m = random_mesh(1001);
+    Harmony::STL::recompute_normals(m.tris);
+    for (const auto& t : m.tris) check_same(t.normal, Harmony::STL::face_normal(t));
+    check_same(m.tris[4].normal, Vec3{});
+}
+
+TEST_CASE("Normals: only missing normals are filled") {
+    const Mesh ref = random_mesh(1001);
+    Mesh m = ref;
+    const std::size_t filled = Harmony::STL::fill_missing_normals(m.tris);
+    REQUIRE(filled == 334);
+    for (std::size_t i = 0; i < m.tris.size(); ++i) {
+        if (i % 3 == 0) check_same(m.tris[i].normal, Harmony::STL::face_normal(ref.tris[i]));
+        else check_same(m.tris[i].normal, Vec3{0, 0, 7});
+    }
+}
+
+TEST_CASE("Normals: SoA kernels agree with the AoS ones") {
+    Mesh m = random_mesh(77);
+    MeshSoA soa = Harmony::STL::to_soa(m);
+
+    REQUIRE(Harmony::STL::fill_missing_normals(soa) == Harmony::STL::fill_missing_normals(m.tris));
+    for (std::size_t i = 0; i < m.tris.size(); ++i) check_same(soa[i].normal, m.tris[i].normal);
+
+    Harmony::STL::recompute_normals(soa);
+    Harmony::STL::recompute_normals(m.tris);
+    for (std::size_t i = 0; i < m.tris.size(); ++i) check_same(soa[i].normal, m.tris[i].normal);
+
+    MeshSoA empty;
+    REQUIRE(Harmony::STL::fill_missing_normals(empty) == 0);
+    Harmony::STL::recompute_normals(std::span<Triangle>{});
+}
@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "Harmony/STL/Ascii.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Normals.h"
+#include "Harmony/STL/Parse.h"
+#include "Harmony/STL/Parser.h"
+#include "TestMesh.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+using Catch::Matchers::ContainsSubstring;
+
+using Harmony::STL::Mesh;
+using Harmony::STL::MeshLayout;
+using Harmony::STL::NormalPolicy;
+using Harmony::STL::ParseConfig;
+using Harmony::STL::Parser;
+using Harmony::STL::Triangle;
+using Harmony::STL::Vec3;
+
+static std::string binary_bytes(const Mesh& m) {
+    std::ostringstream os(std::ios::binary);
+    REQUIRE(Harmony::STL::Binary::serialize(os, m, m.name));
+    return os.str();
+}
+
+TEST_CASE("Parser: parse_into reuses the mesh capacity across files") {
+    Parser parser;
+    Mesh mesh;
+
+    const std::string big = Harmony::STL::ASCII::serialize(make_mesh(500, "big"));
+    REQUIRE(parser.parse_into(big, mesh).has_value());
+    REQUIRE(mesh.tris.size() == 500);
+    REQUIRE(mesh.name == "big");
+    const Triangle* storage = mesh.tris.data();
+    const std::size_t capacity = mesh.tris.capacity();
+
+    // Smaller files of either format land in the same storage
+    const std::string small_bin = binary_bytes(make_mesh(120, "small-bin"));
+    REQUIRE(parser.parse_into(small_bin, mesh).has_value());
+    REQUIRE(mesh.tris.size() == 120);
+    REQUIRE(mesh.name == "small-bin");
+    REQUIRE(mesh.tris.data() == storage);
+
+    const std::string small_txt = Harmony::STL::ASCII::serialize(make_mesh(300, "small-txt"));
+    REQUIRE(parser.parse_into(small_txt, mesh).has_value());
+    REQUIRE(mesh.tris.size() == 300);
+    REQUIRE(mesh.tris.data() == storage);
+    REQUIRE(mesh.tris.capacity() == capacity);
+    REQUIRE(mesh.tris[299].v[0].x == 299.0f);
+    REQUIRE(mesh.tris[0].normal.x == 1.0f); // missing normals still filled
+}
+
+TEST_CASE("Parser: streams share one read buffer; errors leave the mesh empty") {
+    Parser parser(Harmony::STL::ParseOptions{.compute_missing_normals = false});
+    Mesh mesh;
+
+    std::istringstream first(binary_bytes(make_mesh(4000, "stream")), std::ios::binary);
+    REQUIRE(parser.parse_into(first, mesh).has_value());
+    REQUIRE(mesh.tris.size() == 4000);
+    const std::size_t buffer = parser.buffer_capacity();
+    REQUIRE(buffer >= 84 + 4000 * 50);
+
+    std::istringstream bad("solid x\n  facet normal 0 0 1\n    outer loop\n      vertex 0 0\n");
+    auto r = parser.parse_into(bad, mesh);
+    REQUIRE_FALSE(r.has_value());
+    REQUIRE_THAT(r.error(), ContainsSubstring("Line 4"));
+    REQUIRE(mesh.tris.empty());
+
+    std::istringstream second(Harmony::STL::ASCII::serialize(make_mesh(10, "again")));
+    REQUIRE(parser.parse_into(second, mesh).has_value());
+    REQUIRE(mesh.tris.size() == 10);
+    REQUIRE(parser.buffer_capacity() == buffer);
+}
+
+TEST_CASE("Parser: load_into from files") {
+    const fs::path path = fs::temp_directory_path() / "harmony_parser_test.stl";
+    {
+        std::ofstream os(path, std::ios::binary);
+        os << binary_bytes(make_mesh(64, "file"));
+    }
+    Parser parser;
+    Mesh mesh;
+    REQUIRE(parser.load_into(path, mesh).has_value());
+    REQUIRE(mesh.tris.size() == 64);
+    REQUIRE(mesh.name == "file");
+    fs::remove(path);
+
+    mesh.attributes.assign(64, 7); // as left by a file that kept its attribute words
+    auto missing = parser.load_into(path, mesh);
+    REQUIRE_FALSE(missing.has_value());
+    REQUIRE_THAT(missing.error(), ContainsSubstring("Cannot open"));
+    REQUIRE(mesh.attributes.empty());
+    REQUIRE(mesh.tris.empty());
+}
+
+static bool same(const Vec3& a, const Vec3& b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+
+// parse<Config>() against the runtime parser with the same normal handling
+template <ParseConfig Config>
+static void check_config(std::string_view bytes) {
+    auto got = Harmony::STL::parse<Config>(bytes);
+    REQUIRE(got.has_value());
+    Mesh want = *Harmony::STL::parse(bytes, Config.normals == NormalPolicy::fill_missing);
+    if constexpr (Config.normals == NormalPolicy::recompute) Harmony::STL::recompute_normals(std::span<Triangle>(want.tris));
+    Mesh mesh;
+    if constexpr (Config.layout == MeshLayout::soa) mesh = Harmony::STL::to_mesh(*got);
+    else mesh = std::move(*got);
+    REQUIRE(mesh.name == want.name);
+    REQUIRE(mesh.tris.size() == want.tris.size());
+    for (std::size_t i = 0; i < want.tris.size(); ++i) {
+        REQUIRE(same(mesh.tris[i].normal, want.tris[i].normal));
+        for (int k = 0; k < 3; ++k) REQUIRE(same(mesh.tris[i].v[k], want.tris[i].v[k]));
+    }
+}
+
+template <NormalPolicy N>
+static void check_policy(std::string_view bytes) {
+    check_config<ParseConfig{N, true, MeshLayout::aos}>(bytes);
+    check_config<ParseConfig{N, true, MeshLayout::soa}>(bytes);
+    check_config<ParseConfig{N, false, MeshLayout::aos}>(bytes);
+    check_config<ParseConfig{N, false, MeshLayout::soa}>(bytes);
+}
+
+TEST_CASE("Parser: parse<ParseConfig> matches the runtime parser in every configuration") {
+    // Every other facet is stored without a normal; the rest have a wrong one
+    const Mesh m = make_mesh(5000, "configs");
+    std::string binary = binary_bytes(m);
+    std::ostringstream ascii;
+    ascii << "solid configs\n";
+    for (std::size_t i = 0; i < m.tris.size(); ++i) {
+        const float nz = i % 2 ? 0.0f : 2.0f;
+        std::memcpy(binary.data() + 84 + i * 50 + 8, &nz, sizeof nz);
+        std::memset(binary.data() + 84 + i * 50, 0, 8);
+        ascii << "facet normal 0 0 " << nz << "\n outer loop\n";
+        for (const Vec3& v : m.tris[i].v) ascii << "  vertex " << v.x << ' ' << v.y << ' ' << v.z << '\n';
+        ascii << " endloop\nendfacet\n";
+    }
+    ascii << "endsolid configs\n";
+    for (const std::string& bytes : {ascii.str(), binary}) {
+        check_policy<NormalPolicy::keep>(bytes);
+        check_policy<NormalPolicy::fill_missing>(bytes);
+        check_policy<NormalPolicy::recompute>(bytes);
+    }
+}
+
+TEST_CASE("Parser: parse<ParseConfig> without validation") {
+    constexpr ParseConfig trusted{.validate = false};
+    // Keywords are only located by position
+    const std::string_view misspelt = "solid s\n facet nromal 0 0 1\n  outer lop\n   vertex 0 0 0\n"
+                                      "   vertx 1 0 0\n   vertex 0 1 0\n  endlop\n endfacet\nendsolid s\n";
+    auto loose = Harmony::STL::ASCII::parse<trusted>(misspelt);
+    REQUIRE(loose.has_value());
+    REQUIRE(loose->name == "s");
+    REQUIRE(loose->tris.size() == 1);
+    REQUIRE(same(loose->tris[0].v[1], Vec3{1, 0, 0}));
+    REQUIRE_FALSE(Harmony::STL::ASCII::parse<ParseConfig{}>(misspelt).has_value());
+
+    // Anything else falls back to the checking parser and its errors
+    for (std::string_view bad : {"solid s\n facet normal 0 0 1\n  outer loop\n   vertex 0 0 0\n"
+                                 "   vertex 1 0 0\n  endloop\n endfacet\nendsolid s\n",
+                                 "solid s\n facet normal 0 0 1\n  outer loop\n   vertex 0 x 0\n",
+                                 "solid s\n facet normal 0 0 1\n  outer loop\n"}) {
+        auto a = Harmony::STL::ASCII::parse<trusted>(bad);
+        auto b = Harmony::STL::ASCII::parse(bad);
+        REQUIRE_FALSE(a.has_value());
+        REQUIRE(a.error() == b.error());
+    }
+    // A file without endsolid is still accepted
+    auto open_ended = Harmony::STL::ASCII::parse<trusted>(std::string_view{
+        "solid s\n facet normal 0 0 1\n  outer loop\n   vertex 0 0 0\n   vertex 1 0 0\n   vertex 0 1 0\n"
+        "  endloop\n endfacet\n"});
+    REQUIRE(open_ended.has_value());
+    REQUIRE(open_ended->tris.size() == 1);
+}
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/ProgressiveLoader.h"
+#include "TestMesh.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+using Harmony::STL::Binary::ProgressiveLoader;
+using Harmony::STL::Mesh;
+using Harmony::STL::Triangle;
+using Harmony::STL::Vec3;
+
+static fs::path write_mesh(const char* file, std::size_t n) {
+    const Mesh m = make_mesh(n);
+    const fs::path path = fs::temp_directory_path() / file;
+    std::ofstream out(path, std::ios::binary);
+    REQUIRE(Harmony::STL::Binary::serialize(out, m, "progressive"));
+    return path;
+}
+
+TEST_CASE("ProgressiveLoader: ranges arrive in order, growing, and cover the file") {
+    const fs::path path = write_mesh("harmony_progressive.stl", 10000);
+    const auto whole = Harmony::STL::Binary::load(path);
+    REQUIRE(whole.has_value());
+
+    for (unsigned threads : {1u, 3u}) {
+        ProgressiveLoader::Config config;
+        config.first_range = 100;
+        config.max_range = 1000;
+        config.threads = threads;
+        config.max_ready = 2;
+        auto loader = ProgressiveLoader::open(path, config);
+        REQUIRE(loader.has_value());
+        REQUIRE(loader->size() == 10000);
+        REQUIRE(loader->name() == "progressive");
+
+        std::size_t expected_first = 0, previous = 0;
+        while (auto range = loader->next()) {
+            REQUIRE(range->first == expected_first);
+            REQUIRE(range->tris.size() >= std::min<std::size_t>(previous, 10000 - range->first));
+            REQUIRE(range->tris.size() <= 1000);
+            REQUIRE(std::memcmp(range->tris.data(), whole->tris.data() + range->first,
+                                range->tris.size() * sizeof(Triangle)) == 0);
+            previous = range->tris.size();
+            expected_first += range->tris.size();
+            REQUIRE(loader->delivered() == expected_first);
+        }
+        REQUIRE(expected_first == 10000);
+        REQUIRE_FALSE(loader->next().has_value());
+    }
+
+    // Abandoning a loader part-way stops its threads
+    ProgressiveLoader::Config config;
+    config.first_range = 10;
+    config.threads = 2;
+    auto early = ProgressiveLoader::open(path, config);
+    REQUIRE(early.has_value());
+    REQUIRE(early->next()->tris.size() == 10);
+
+    std::error_code ec;
+    fs::remove(path, ec);
+}
+
+TEST_CASE("ProgressiveLoader: bad input fails in open()") {
+    REQUIRE_FALSE(ProgressiveLoader::open(fs::temp_directory_path() / "harmony_progressive_missing.stl").has_value());
+
+    const fs::path path = write_mesh("harmony_progressive_short.stl", 20);
+    fs::resize_file(path, fs::file_size(path) - 1);
+    auto r = ProgressiveLoader::open(path);
+    REQUIRE_FALSE(r.has_value());
+    REQUIRE(r.error() == "Binary STL: unexpected EOF in triangle data");
+
+    const fs::path empty = write_mesh("harmony_progressive_empty.stl", 0);
+    auto none = ProgressiveLoader::open(empty);
+    REQUIRE(none.has_value());
+    REQUIRE_FALSE(none->next().has_value());
+
+    std::error_code ec;
+    fs::remove(path, ec);
+    fs::remove(empty, ec);
+}
@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "Harmony/STL/Ascii.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Parse.h"
+#include "Harmony/STL/Reader.h"
+#include "TestMesh.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+using Catch::Matchers::ContainsSubstring;
+
+using Harmony::STL::Format;
+using Harmony::STL::Mesh;
+using Harmony::STL::Reader;
+using Harmony::STL::Triangle;
+using Harmony::STL::Vec3;
+
+// Every other triangle carries a normal
+static Mesh streamed_mesh(std::size_t n) { return with_normals(make_mesh(n, "streamed"), Vec3{1, 0, 0}, 2); }
+
+static std::vector<Triangle> drain(Reader& reader, std::size_t batch, std::vector<std::size_t>* sizes = nullptr) {
+    std::vector<Triangle> all;
+    auto total = Harmony::STL::for_each_batch(reader, batch, [&](std::span<const Triangle> tris) {
+        REQUIRE(tris.size() <= batch);
+        if (sizes) sizes->push_back(tris.size());
+        all.insert(all.end(), tris.begin(), tris.end());
+    });
+    REQUIRE(total.has_value());
+    REQUIRE(*total == all.size());
+    return all;
+}
+
+static void require_same_tris(const std::vector<Triangle>& a, const std::vector<Triangle>& b) {
+    REQUIRE(a.size() == b.size());
+    REQUIRE(std::memcmp(a.data(), b.data(), a.size() * sizeof(Triangle)) == 0);
+}
+
+TEST_CASE("Reader: ASCII stream in fixed-size batches") {
+    const std::string text = Harmony::STL::ASCII::serialize(streamed_mesh(10));
+    std::istringstream is(text);
+    auto reader = Reader::open(is);
+    REQUIRE(reader.has_value());
+    REQUIRE(reader->format() == Format::ascii);
+    REQUIRE_FALSE(reader->expected_count().has_value());
+
+    std::vector<std::size_t> sizes;
+    const auto tris = drain(*reader, 3, &sizes);
+    REQUIRE(sizes == std::vector<std::size_t>{3, 3, 3, 1});
+    REQUIRE(reader->done());
+    REQUIRE(reader->name() == "streamed");
+
+    auto ref = Harmony::STL::ASCII::parse(std::string_view{text});
+    REQUIRE(ref.has_value());
+    require_same_tris(tris, ref->tris);
+}
+
+TEST_CASE("Reader: ASCII lines spanning read blocks") {
+    // Well beyond one 64 KiB block, so lines straddle refills
+    const std::string text = Harmony::STL::ASCII::serialize(streamed_mesh(3000));
+    std::istringstream is(text);
+    auto reader = Reader::open(is, Format::ascii);
+    REQUIRE(reader.has_value());
+    const auto tris = drain(*reader, 256);
+
+    auto ref = Harmony::STL::ASCII::parse(std::string_view{text});
+    REQUIRE(ref.has_value());
+    require_same_tris(tris, ref->tris);
+
+    // The stream overload of ASCII::parse goes through the reader too
+    std::istringstream again(text);
+    auto streamed = Harmony::STL::ASCII::parse(again);
+    REQUIRE(streamed.has_value());
+    REQUIRE(streamed->name == "streamed");
+    require_same_tris(streamed->tris, ref->tris);
+}
+
+TEST_CASE("Reader: binary stream and header count") {
+    std::ostringstream os(std::ios::binary);
+    REQUIRE(Harmony::STL::Binary::serialize(os, streamed_mesh(5000), "bin-stream"));
+    const std::string bytes = os.str();
+
+    std::istringstream is(bytes, std::ios::binary);
+    auto reader = Reader::open(is);
+    REQUIRE(reader.has_value());
+    REQUIRE(reader->format() == Format::binary);
+    REQUIRE(reader->name() == "bin-stream");
+    REQUIRE(reader->expected_count() == 5000u);
+    const auto tris = drain(*reader, 1000);
+
+    auto ref = Harmony::STL::Binary::parse(std::string_view{bytes});
+    REQUIRE(ref.has_value());
+    require_same_tris(tris, ref->tris);
+}
+
+TEST_CASE("Reader: errors match the parsers and are sticky") {
+    SECTION("ASCII syntax error keeps its line number") {
+        std::string text = Harmony::STL::ASCII::serialize(streamed_mesh(50));
+        text.replace(text.find("vertex", text.size() / 2), 6, "vortex");
+        auto ref = Harmony::STL::ASCII::parse(std::string_view{text});
+        REQUIRE_FALSE(ref.has_value());
+
+        std::istringstream is(text);
+        auto reader = Reader::open(is);
+        REQUIRE(reader.has_value());
+        std::vector<Triangle> batch(8);
+        std::expected<std::size_t, std::string> n;
+        while ((n = reader->next_batch(batch)) && *n) {}
+        REQUIRE_FALSE(n.has_value());
+        REQUIRE(n.error() == ref.error());
+        REQUIRE(reader->done());
+        REQUIRE(reader->next_batch(batch).error() == ref.error());
+    }
+
+    SECTION("a line without end is refused, not buffered") {
+        std::string text = "solid s\n facet normal 0 0 1 ";
+        text.append(std::size_t{4} << 20, '0');
+        std::istringstream is(text);
+        auto reader = Reader::open(is);
+        REQUIRE(reader.has_value());
+        std::vector<Triangle> batch(8);
+        auto n = reader->next_batch(batch);
+        REQUIRE_FALSE(n.has_value());
+        REQUIRE(n.error() == "Line 2: longer than 1048576 bytes");
+    }
+
+    SECTION("truncated binary") {
+        std::ostringstream os(std::ios::binary);
+        REQUIRE(Harmony::STL::Binary::serialize(os, streamed_mesh(4)));
+        const std::string bytes = os.str().substr(0, os.str().size() - 10);
+        std::istringstream is(bytes, std::ios::binary);
+        auto reader = Reader::open(is);
+        REQUIRE(reader.has_value());
+        std::vector<Triangle> batch(16);
+        auto n = reader->next_batch(batch);
+        REQUIRE_FALSE(n.has_value());
+        REQUIRE_THAT(n.error(), ContainsSubstring("unexpected EOF"));
+    }
+
+    SECTION("short binary header") {
+        std::istringstream is(std::string(40, 'x'), std::ios::binary);
+        auto reader = Reader::open(is);
+        REQUIRE_FALSE(reader.has_value());
+        REQUIRE_THAT(reader.error(), ContainsSubstring("80-byte header"));
+    }
+}
+
+TEST_CASE("Reader: long lines through the whole-mesh stream parsers") {
+    // A 2 MiB 'solid' line, over the reader's default cap
+    const std::string name(std::size_t{2} << 20, 'n');
+    const std::string text = "solid " + name + "\n"
+                             "facet normal 0 0 1\n outer loop\n"
+                             "  vertex 0 0 0\n  vertex 1 0 0\n  vertex 0 1 0\n"
+                             " endloop\nendfacet\nendsolid\n";
+    auto ref = Harmony::STL::ASCII::parse(std::string_view{text});
+    REQUIRE(ref.has_value());
+    REQUIRE(ref->name == name);
+    REQUIRE(ref->tris.size() == 1);
+
+    std::istringstream a(text);
+    auto ascii = Harmony::STL::ASCII::parse(a);
+    std::istringstream d(text);
+    auto detected = Harmony::STL::parse(d);
+    for (const auto* m : {&ascii, &detected}) {
+        REQUIRE(m->has_value());
+        REQUIRE((*m)->name == ref->name);
+        REQUIRE((*m)->tris.size() == 1);
+        REQUIRE(std::memcmp((*m)->tris.data(), ref->tris.data(), sizeof(Triangle)) == 0);
+    }
+
+    // A Reader keeps its cap unless told otherwise
+    std::vector<Triangle> batch(4);
+    std::istringstream capped(text);
+    auto reader = Reader::open(capped);
+    REQUIRE(reader.has_value());
+    REQUIRE(reader->next_batch(batch).error() == "Line 1: longer than 1048576 bytes");
+
+    std::istringstream lifted(text);
+    reader = Reader::open(lifted);
+    REQUIRE(reader.has_value());
+    reader->limit_line_length(0);
+    REQUIRE(reader->next_batch(batch) == 1);
+    REQUIRE(reader->name() == name);
+}
+
+TEST_CASE("Reader: open from a path") {
+    const fs::path path = fs::temp_directory_path() / "harmony_reader_test.stl";
+    {
+        std::ofstream os(path, std::ios::binary);
+        REQUIRE(Harmony::STL::Binary::serialize(os, streamed_mesh(7), "file"));
+    }
+    auto reader = Reader::open(path);
+    REQUIRE(reader.has_value());
+    Reader moved = std::move(*reader);
+    REQUIRE(drain(moved, 4).size() == 7);
+    REQUIRE(moved.name() == "file");
+    fs::remove(path);
+
+    REQUIRE_FALSE(Reader::open(fs::temp_directory_path() / "harmony_missing_file.stl").has_value());
+}
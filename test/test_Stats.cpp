@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------
+// Project: Harmony Geometry Serialization Deserialization Library
+// Copyright(c) 2025 Onur Tuncer, PhD, Istanbul Technical University
+//
+// SPDX - License - Identifier : BSD-3-Clause
+// License - Filename : LICENSE
+// ----------------------------------------------------------------------
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Harmony/STL/Ascii.h"
+#include "Harmony/STL/Binary.h"
+#include "Harmony/STL/Parse.h"
+#include "Harmony/STL/Stats.h"
+#include "TestMesh.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using Harmony::STL::Mesh;
+using Harmony::STL::Stats;
+using Harmony::STL::Vec3;
+using Harmony::STL::last_stats;
+
+// A quarter of the normals missing
+static Mesh stats_mesh(std::size_t n) { return with_normals(make_mesh(n, "stats"), Vec3{1, 0, 0}, 4); }
+
+TEST_CASE("Stats: ASCII parse and serialize counters") {
+    const Mesh m = stats_mesh(400);
+    const std::string text = Harmony::STL::ASCII::serialize(m);
+    const Stats written = last_stats();
+
+    auto parsed = Harmony::STL::ASCII::parse(std::string_view{text});
+    REQUIRE(parsed.has_value());
+    const Stats read = last_stats();
+
+    if constexpr (!Harmony::STL::stats_enabled) {
+        REQUIRE(read.facets == 0);
+        REQUIRE(read.total.count() == 0);
+        return;
+    }
+    REQUIRE(written.facets == 400);
+    REQUIRE(written.bytes_written == text.size());
+    REQUIRE(written.normals_computed == 100);
+
+    REQUIRE(read.bytes_read == text.size());
+    REQUIRE(read.facets == 400);
+    REQUIRE(read.lines == 2 + 400 * 7);
+    REQUIRE(read.normals_computed == 0); // the serializer already filled them
+    REQUIRE(read.reallocations == 0);    // reserved from the facet pre-count
+    REQUIRE(read.slow_floats == 0);
+    REQUIRE(read.scan.count() > 0);
+    REQUIRE(read.total >= read.scan + read.normals);
+}
+
+TEST_CASE("Stats: binary streams, nesting and the hook") {
+    const Mesh m = stats_mesh(5000);
+    std::ostringstream os(std::ios::binary);
+    REQUIRE(Harmony::STL::Binary::serialize(os, m, m.name));
+    // The serializer fills missing normals; zero a quarter of them again
+    std::string bytes = os.str();
+    for (std::size_t i = 0; i < m.tris.size(); i += 4)
+        std::fill_n(bytes.begin() + static_cast<std::ptrdiff_t>(Harmony::STL::Binary::prefix_size + i * 50), 12, '\0');
+
+    std::vector<std::string> operations;
+    std::vector<Stats> reported;
+    Harmony::STL::set_stats_hook([&](std::string_view op, const Stats& s) {
+        operations.emplace_back(op);
+        reported.push_back(s);
+    });
+
+    std::istringstream is(bytes, std::ios::binary);
+    auto a = Harmony::STL::Binary::parse(is, true);
+    REQUIRE(a.has_value());
+    // The detecting parse folds into the Binary::parse it dispatches to
+    auto b = Harmony::STL::parse(std::string_view{bytes});
+    REQUIRE(b.has_value());
+    Harmony::STL::set_stats_hook({});
+    REQUIRE(Harmony::STL::ASCII::parse(std::string_view{"solid x\nendsolid x\n"}).has_value());
+
+    if constexpr (!Harmony::STL::stats_enabled) {
+        REQUIRE(operations.empty());
+        return;
+    }
+    REQUIRE(operations == std::vector<std::string>{"Binary::parse", "Binary::parse"});
+    const Stats& streamed = reported[0];
+    REQUIRE(streamed.bytes_read == bytes.size());
+    REQUIRE(streamed.facets == 5000);
+    REQUIRE(streamed.normals_computed == 1250);
+    REQUIRE(streamed.io.count() > 0);
+    REQUIRE(streamed.decode.count() > 0);
+    REQUIRE(reported[1].facets == 5000);
+    REQUIRE(last_stats().lines == 2); // the last call, after the hook was removed
+}